@@ -0,0 +1,66 @@
+# sevobench_add_kernel_dispatch(<target>)
+#
+# Compiles the SEvoBench SIMD kernels for SSE4.2, AVX2 and AVX-512 into
+# <target> and registers, at start-up, every build the running CPU supports.
+# Problems then use the widest registered kernels instead of the ones the
+# rest of <target> was compiled for, so a baseline build still runs the
+# AVX-512 kernels on a machine that has them. Call it once per executable;
+# it defines SEVOBENCH_KERNEL_DISPATCH for <target>, which every translation
+# unit using the problems must see.
+#
+# The builds go into the object library <target>_kernels. Inline functions
+# they instantiate, std::sqrt(float) among them, are made local to each build
+# (-fno-weak where supported), so the linker can never pick an AVX-512 copy
+# for the rest of the program.
+include(CheckCXXCompilerFlag)
+check_cxx_compiler_flag(-fno-weak SEVOBENCH_HAS_NO_WEAK)
+if(NOT DEFINED SEVOBENCH_DISPATCH_DIR)
+  set(SEVOBENCH_DISPATCH_DIR
+      "${CMAKE_CURRENT_LIST_DIR}/../include/SEvoBench/problem/dispatch")
+endif()
+
+function(sevobench_add_kernel_dispatch target)
+  if(NOT CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|x86|i[3-6]86)$")
+    return()
+  endif()
+  if(MSVC)
+    set(flags_sse42 "/DINSTRSET=6")
+    set(flags_avx2 "/arch:AVX2;/DINSTRSET=8")
+    set(flags_avx512 "/arch:AVX512;/DINSTRSET=10")
+  else()
+    set(flags_sse42 "-march=x86-64-v2")
+    set(flags_avx2 "-march=x86-64-v3")
+    set(flags_avx512 "-march=x86-64-v4")
+    if(SEVOBENCH_HAS_NO_WEAK)
+      foreach(isa sse42 avx2 avx512)
+        list(APPEND flags_${isa} "-fno-weak")
+      endforeach()
+    endif()
+  endif()
+  set(dir "${CMAKE_CURRENT_BINARY_DIR}/${target}_kernels")
+  set(has)
+  set(sources)
+  foreach(isa sse42 avx2 avx512)
+    set(src "${dir}/kernel_${isa}.cpp")
+    file(WRITE "${src}.in"
+         "#include \"${SEVOBENCH_DISPATCH_DIR}/kernel_isa.cpp\"\n")
+    configure_file("${src}.in" "${src}" COPYONLY)
+    set_source_files_properties("${src}" PROPERTIES
+        COMPILE_OPTIONS "${flags_${isa}}"
+        COMPILE_DEFINITIONS "SEVOBENCH_KERNEL_ISA=${isa}")
+    list(APPEND sources "${src}")
+    string(TOUPPER ${isa} ISA)
+    list(APPEND has "SEVOBENCH_KERNEL_HAS_${ISA}")
+  endforeach()
+  set(src "${dir}/kernel_dispatch.cpp")
+  file(WRITE "${src}.in"
+       "#include \"${SEVOBENCH_DISPATCH_DIR}/kernel_dispatch.cpp\"\n")
+  configure_file("${src}.in" "${src}" COPYONLY)
+  set_source_files_properties("${src}" PROPERTIES COMPILE_DEFINITIONS "${has}")
+  add_library(${target}_kernels OBJECT ${sources} "${src}")
+  set_target_properties(${target}_kernels PROPERTIES
+      CXX_STANDARD 20
+      CXX_STANDARD_REQUIRED ON)
+  target_sources(${target} PRIVATE $<TARGET_OBJECTS:${target}_kernels>)
+  target_compile_definitions(${target} PRIVATE SEVOBENCH_KERNEL_DISPATCH)
+endfunction()
@@ -0,0 +1,23 @@
+#include "SEvoBench/sevobench.hpp"
+#include <iostream>
+
+// Usage: cec_data_pack <data_dir>...
+// Writes <data_dir>/cec_data.pack, e.g. for cec2014_data, cec2017_data,
+// cec2020_data and cec2022_data. Suites built with .dir(<data_dir>) map the
+// pack and fall back to the text files when it is absent.
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "usage: " << argv[0] << " <data_dir>...\n";
+    return 1;
+  }
+  int status = 0;
+  for (int i = 1; i < argc; i++) {
+    if (sevobench::problem::cec_detail::pack_cec_data(argv[i])) {
+      std::cout << "packed " << argv[i] << "\n";
+    } else {
+      std::cerr << "failed to pack " << argv[i] << "\n";
+      status = 1;
+    }
+  }
+  return status;
+}
@@ -2,10 +2,36 @@
 
 #pragma once
 
+#include "de_async.hpp"
 #include "de_config.hpp"
 
 namespace sevobench::de_module {
 
+namespace detail {
+template <bool Use_Archive, std::floating_point T>
+inline void de_run(auto &config, auto &&pop, auto &&f, T lb, T ub,
+                   evolutionary_algorithm &alg, auto condition) noexcept {
+  alg.set_pop_size(pop.pop_size());
+  alg.set_dim(pop.dim());
+  if constexpr (Use_Archive) {
+    module_ref(config.archive).prepare(pop);
+  }
+  const bool resumed = checkpoint_scope::restore(alg, pop, config);
+  if (!resumed) {
+    evaluate_population(pop, f, pop.pop_size());
+    alg.add_fes(pop.pop_size());
+  }
+  population<T> trial(pop.pop_size(), pop.dim());
+  if (!resumed || condition(pop, alg)) {
+    do {
+      config.iterator(pop, trial, f, lb, ub, alg);
+      checkpoint_scope::save(alg.current_iterator(), alg, pop, config);
+    } while (condition(pop, alg));
+  }
+  checkpoint_scope::save(-1, alg, pop, config);
+}
+} // namespace detail
+
 template <bool Use_Archive, std::floating_point T> class de_algorithm {
   de_config<Use_Archive, T> config_;
 
@@ -24,18 +50,7 @@ public:
            evolutionary_algorithm &alg, F condition = {})
 
       noexcept {
-    population<T> trial(pop.pop_size(), pop.dim());
-    alg.set_pop_size(pop.pop_size());
-    alg.set_dim(pop.dim());
-    if constexpr (Use_Archive) {
-      config_.archive->prepare(pop);
-    }
-    for (auto &_ : pop)
-      _.evaluate(f);
-    alg.add_fes(pop.pop_size());
-    do {
-      config_.iterator(pop, trial, f, lb, ub, alg);
-    } while (condition(pop, alg));
+    detail::de_run<Use_Archive>(config_, pop, f, lb, ub, alg, condition);
   }
   template <typename F = evolutionary_algorithm_condition>
   void run(std::convertible_to<population<T>> auto &&pop, auto &&f,
@@ -45,6 +60,26 @@ public:
     run(pop, f, f.lower_bound(), f.upper_bound(), alg, condition);
   }
 
+  // Steady-state variant of run(): up to in_flight trial evaluations run on
+  // pool at once, and each trial is selected as soon as it is evaluated. f
+  // must be safe to call concurrently, and pool should not be the pool this
+  // run itself executes on.
+  template <typename F = evolutionary_algorithm_condition>
+  void run_async(std::convertible_to<population<T>> auto &&pop, auto &&f,
+                 T lb, T ub, evolutionary_algorithm &alg, parallel_task &pool,
+                 int in_flight, F condition = {}) noexcept {
+    detail::de_run_async<Use_Archive>(config_, pop, f, lb, ub, alg, pool,
+                                      in_flight, condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_async(std::convertible_to<population<T>> auto &&pop, auto &&f,
+                 evolutionary_algorithm &alg, parallel_task &pool,
+                 int in_flight, F condition = {}) noexcept {
+    run_async(pop, f, f.lower_bound(), f.upper_bound(), alg, pool, in_flight,
+              condition);
+  }
+
   [[nodiscard]] auto mutation() noexcept { return config_.mutation.get(); }
   auto replace_mutation(std::unique_ptr<de_mutation<T>> &&ptr) noexcept {
     config_.mutation = std::move(ptr);
@@ -174,7 +209,10 @@ public:
         .constraint_handler = std::move(config_.constraint_handler),
         .crossover = std::move(config_.crossover),
         .population_strategy = std::move(config_.population_strategy),
-        .archive = std::move(a)};
+        .archive = std::move(a),
+        .fs = {},
+        .crs = {},
+        .base = {}};
     return de_algorithm_builder<T, true, B1, B2, B3, B4, B5>(
         std::move(_config));
   }
@@ -191,4 +229,176 @@ public:
   }
 };
 
+// de_algorithm over a static_de_config: the modules are members of their
+// concrete types and are returned by reference.
+template <typename Config> class static_de_algorithm {
+  using T = typename Config::value_type;
+  Config config_;
+
+public:
+  using value_type = T;
+  static constexpr auto use_archive() { return Config::use_archive; }
+
+  static_de_algorithm(Config &&_config) : config_(std::move(_config)) {}
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run(std::convertible_to<population<T>> auto &&pop, auto &&f, T lb, T ub,
+           evolutionary_algorithm &alg, F condition = {}) noexcept {
+    detail::de_run<Config::use_archive>(config_, pop, f, lb, ub, alg,
+                                        condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run(std::convertible_to<population<T>> auto &&pop, auto &&f,
+           evolutionary_algorithm &alg, F condition = {}) noexcept {
+    run(pop, f, f.lower_bound(), f.upper_bound(), alg, condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_async(std::convertible_to<population<T>> auto &&pop, auto &&f,
+                 T lb, T ub, evolutionary_algorithm &alg, parallel_task &pool,
+                 int in_flight, F condition = {}) noexcept {
+    detail::de_run_async<Config::use_archive>(config_, pop, f, lb, ub, alg,
+                                              pool, in_flight, condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_async(std::convertible_to<population<T>> auto &&pop, auto &&f,
+                 evolutionary_algorithm &alg, parallel_task &pool,
+                 int in_flight, F condition = {}) noexcept {
+    run_async(pop, f, f.lower_bound(), f.upper_bound(), alg, pool, in_flight,
+              condition);
+  }
+
+  [[nodiscard]] auto &mutation() noexcept { return config_.mutation; }
+
+  [[nodiscard]] auto &parameter() noexcept { return config_.parameter; }
+
+  [[nodiscard]] auto &constraint_handler() noexcept {
+    return config_.constraint_handler;
+  }
+
+  [[nodiscard]] auto &crossover() noexcept { return config_.crossover; }
+
+  [[nodiscard]] auto &population_strategy() noexcept {
+    return config_.population_strategy;
+  }
+
+  [[nodiscard]] auto &archive() noexcept
+    requires(Config::use_archive)
+  {
+    return config_.archive;
+  }
+
+  void iterator(auto &&pop, auto &&trial, auto &&f, T lb, T ub,
+                evolutionary_algorithm &alg) noexcept {
+    config_.iterator(pop, trial, f, lb, ub, alg);
+  }
+};
+
+// Compile-time counterpart of de_algorithm_builder: each setter takes a
+// concrete module and records its type, so build() yields a
+// static_de_algorithm with no virtual dispatch between the modules.
+template <std::floating_point T = float, typename P = detail::no_module,
+          typename M = detail::no_module, typename C = detail::no_module,
+          typename X = detail::no_module, typename S = detail::no_module,
+          typename A = detail::no_module>
+class [[nodiscard]] static_de_algorithm_builder {
+  static_de_config<T, P, M, C, X, S, A> config_;
+
+  template <std::floating_point, typename, typename, typename, typename,
+            typename, typename>
+  friend class static_de_algorithm_builder;
+
+  template <typename P2, typename M2, typename C2, typename X2, typename S2,
+            typename A2>
+  static auto rebuild(P2 &&p, M2 &&m, C2 &&c, X2 &&x, S2 &&s,
+                      A2 &&a) noexcept {
+    using builder = static_de_algorithm_builder<
+        T, std::remove_cvref_t<P2>, std::remove_cvref_t<M2>,
+        std::remove_cvref_t<C2>, std::remove_cvref_t<X2>,
+        std::remove_cvref_t<S2>, std::remove_cvref_t<A2>>;
+    return builder(decltype(builder::config_){
+        .parameter = std::forward<P2>(p),
+        .mutation = std::forward<M2>(m),
+        .constraint_handler = std::forward<C2>(c),
+        .crossover = std::forward<X2>(x),
+        .population_strategy = std::forward<S2>(s),
+        .archive = std::forward<A2>(a),
+        .fs = {},
+        .crs = {},
+        .base = {}});
+  }
+
+public:
+  static_de_algorithm_builder() = default;
+
+  static_de_algorithm_builder(static_de_config<T, P, M, C, X, S, A> &&_config)
+      : config_(std::move(_config)) {}
+
+  template <std::derived_from<de_mutation<T>> U>
+  [[nodiscard]] auto mutation(U &&m) noexcept {
+    return rebuild(std::move(config_.parameter), std::forward<U>(m),
+                   std::move(config_.constraint_handler),
+                   std::move(config_.crossover),
+                   std::move(config_.population_strategy),
+                   std::move(config_.archive));
+  }
+
+  template <std::derived_from<de_constraint<T>> U>
+  [[nodiscard]] auto constraint_handler(U &&c) noexcept {
+    return rebuild(std::move(config_.parameter), std::move(config_.mutation),
+                   std::forward<U>(c), std::move(config_.crossover),
+                   std::move(config_.population_strategy),
+                   std::move(config_.archive));
+  }
+
+  template <std::derived_from<de_crossover<T>> U>
+  [[nodiscard]] auto crossover(U &&c) noexcept {
+    return rebuild(std::move(config_.parameter), std::move(config_.mutation),
+                   std::move(config_.constraint_handler), std::forward<U>(c),
+                   std::move(config_.population_strategy),
+                   std::move(config_.archive));
+  }
+
+  template <std::derived_from<de_parameter<T>> U>
+  [[nodiscard]] auto parameter(U &&p) noexcept {
+    return rebuild(std::forward<U>(p), std::move(config_.mutation),
+                   std::move(config_.constraint_handler),
+                   std::move(config_.crossover),
+                   std::move(config_.population_strategy),
+                   std::move(config_.archive));
+  }
+
+  template <std::derived_from<de_population<T>> U>
+  [[nodiscard]] auto population_strategy(U &&p) noexcept {
+    return rebuild(std::move(config_.parameter), std::move(config_.mutation),
+                   std::move(config_.constraint_handler),
+                   std::move(config_.crossover), std::forward<U>(p),
+                   std::move(config_.archive));
+  }
+
+  template <std::derived_from<de_archive<T>> U>
+  [[nodiscard]] auto archive(U &&a) noexcept {
+    return rebuild(std::move(config_.parameter), std::move(config_.mutation),
+                   std::move(config_.constraint_handler),
+                   std::move(config_.crossover),
+                   std::move(config_.population_strategy), std::forward<U>(a));
+  }
+
+  [[nodiscard]] auto build() noexcept {
+    static_assert(!std::is_same_v<M, detail::no_module>,
+                  "MUTATION IS MISSING!");
+    static_assert(!std::is_same_v<C, detail::no_module>,
+                  "CONSTRAINT HANDLER IS MISSING!");
+    static_assert(!std::is_same_v<X, detail::no_module>,
+                  "CROSSOVER IS MISSING!");
+    static_assert(!std::is_same_v<P, detail::no_module>,
+                  "PARAMETER IS MISSING!");
+    static_assert(!std::is_same_v<S, detail::no_module>,
+                  "POPULATION STRATEGY IS MISSING!");
+    return static_de_algorithm(std::move(config_));
+  }
+};
+
 } // namespace sevobench::de_module
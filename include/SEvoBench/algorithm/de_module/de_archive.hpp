@@ -1,4 +1,5 @@
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../evolutionary_algorithm.hpp"
 
@@ -16,6 +17,8 @@ public:
 
   virtual void prepare(const population<T> &) = 0;
 
+  virtual void serialize(checkpoint &ar) { ar(archive_); }
+
   virtual ~de_archive() = default;
 };
 
@@ -40,7 +43,7 @@ public:
   }
 
   void add(solution<T> &sol) override {
-    std::swap(this->archive_[replace_index++], sol);
+    std::ranges::swap(this->archive_[replace_index++], sol);
     replace_index %= Archive_Size;
     A_Size = Archive_Size == A_Size ? Archive_Size : A_Size + 1;
   }
@@ -68,6 +71,11 @@ public:
   std::span<const solution<T>> get() override {
     return std::span<const solution<T>>(this->archive_.data(), A_Size);
   }
+
+  void serialize(checkpoint &ar) override {
+    de_archive<T>::serialize(ar);
+    ar(replace_index, A_Size, Archive_Size);
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -96,7 +104,7 @@ public:
   }
 
   void add(solution<T> &sol) override {
-    std::swap(this->archive_[replace_index++], sol);
+    std::ranges::swap(this->archive_[replace_index++], sol);
     A_Size++;
   }
 
@@ -106,7 +114,7 @@ public:
       int len = A_Size - Archive_Size;
       for (int i = 0; i < len; i++) {
         auto i1 = RNG.rand_int(A_Size--);
-        std::swap(this->archive_[i1], this->archive_[A_Size]);
+        std::ranges::swap(this->archive_[i1], this->archive_[A_Size]);
       }
       replace_index = Archive_Size;
     }
@@ -115,5 +123,10 @@ public:
   std::span<const solution<T>> get() override {
     return std::span<const solution<T>>(this->archive_.data(), A_Size);
   }
+
+  void serialize(checkpoint &ar) override {
+    de_archive<T>::serialize(ar);
+    ar(replace_index, A_Size, Archive_Size, RNG);
+  }
 };
 } // namespace sevobench::de_module
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../../utility/parallel_task.hpp"
+#include "de_config.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace sevobench::de_module {
+namespace detail {
+// Evaluates solutions on a parallel_task pool and hands back the tag of each
+// one in completion order. The objective is called from several threads at
+// once; de_run_async passes it through concurrent_objective.
+template <std::floating_point T> class async_evaluator {
+  parallel_task &pool;
+  std::mutex mut;
+  std::condition_variable cond;
+  std::deque<int> ready;
+  int in_flight = 0;
+
+public:
+  explicit async_evaluator(parallel_task &_pool) noexcept : pool(_pool) {}
+  async_evaluator(const async_evaluator &) = delete;
+  async_evaluator &operator=(const async_evaluator &) = delete;
+  ~async_evaluator() {
+    while (in_flight > 0)
+      wait();
+  }
+
+  auto size() const noexcept { return in_flight; }
+
+  void submit(solution<T> &x, auto &f, int tag) noexcept {
+    in_flight++;
+    [[maybe_unused]] auto _ = pool.submit([this, &x, &f, tag] {
+      x.evaluate(f);
+      std::lock_guard<std::mutex> lck(mut);
+      ready.push_back(tag);
+      cond.notify_one();
+    });
+  }
+
+  int wait() noexcept {
+    std::unique_lock<std::mutex> lck(mut);
+    cond.wait(lck, [this] { return !ready.empty(); });
+    auto tag = ready.front();
+    ready.pop_front();
+    in_flight--;
+    return tag;
+  }
+};
+
+// One generation with up to in_flight trials being evaluated at once. Each
+// trial is generated from the population as it stands when it is issued and
+// selected as soon as its fitness arrives. The generation still ends with a
+// barrier, since prepare() and resize() may reorder the population.
+template <bool Use_Archive, std::floating_point T>
+inline void de_iterate_async(auto &c, auto &&pop, auto &&trial,
+                             population<T> &parents, auto &&f, T lb, T ub,
+                             evolutionary_algorithm &alg,
+                             async_evaluator<T> &ev, int in_flight) noexcept {
+  auto &parameter = module_ref(c.parameter);
+  auto &mutation = module_ref(c.mutation);
+  auto &constraint_handler = module_ref(c.constraint_handler);
+  auto &crossover = module_ref(c.crossover);
+  auto &population_strategy = module_ref(c.population_strategy);
+  [[maybe_unused]] auto &archive = module_ref(c.archive);
+  parameter.prepare(pop);
+  mutation.prepare(pop);
+  crossover.prepare(pop);
+  parents = pop;
+  auto select = [&](int i) {
+    alg.add_fes(1);
+    if (trial[i].fitness() < pop[i].fitness()) {
+      pop[i] = trial[i];
+      if constexpr (Use_Archive) {
+        archive.add(parents[i]);
+      }
+    }
+  };
+  for (int i = 0; i < pop.pop_size(); i++) {
+    if (ev.size() >= in_flight)
+      select(ev.wait());
+    const auto fi = parameter.get_f(i);
+    do {
+      if constexpr (Use_Archive) {
+        mutation.mutate(trial[i], pop, archive.get(), fi, i);
+      } else {
+        mutation.mutate(trial[i], pop, fi, i);
+      }
+      constraint_handler.repair(trial[i], lb, ub,
+                                pop[mutation.base_index(i)], pop[i]);
+    } while (!constraint_handler.is_repair(
+        trial[i], lb, ub, pop[mutation.base_index(i)], pop[i]));
+    crossover.crossover(trial[i], pop[i], parameter.get_cr(i));
+    ev.submit(trial[i], f, i);
+  }
+  while (ev.size() > 0)
+    select(ev.wait());
+  parameter.update(parents, trial);
+  population_strategy.resize(pop);
+  alg.set_pop_size(pop.pop_size());
+  if constexpr (Use_Archive) {
+    archive.resize(pop);
+  }
+  alg.increment_iterator();
+}
+
+template <bool Use_Archive, std::floating_point T>
+inline void de_run_async(auto &config, auto &&pop, auto &&f0, T lb, T ub,
+                         evolutionary_algorithm &alg, parallel_task &pool,
+                         int in_flight, auto condition) noexcept {
+  std::mutex mut;
+  auto &&f = concurrent_objective(f0, mut);
+  population<T> parents;
+  in_flight = std::max(in_flight, 1);
+  alg.set_pop_size(pop.pop_size());
+  alg.set_dim(pop.dim());
+  if constexpr (Use_Archive) {
+    module_ref(config.archive).prepare(pop);
+  }
+  async_evaluator<T> ev(pool);
+  const bool resumed = checkpoint_scope::restore(alg, pop, config);
+  if (!resumed) {
+    for (int i = 0; i < pop.pop_size(); i++) {
+      if (ev.size() >= in_flight)
+        ev.wait();
+      ev.submit(pop[i], f, i);
+    }
+    while (ev.size() > 0)
+      ev.wait();
+    alg.add_fes(pop.pop_size());
+  }
+  population<T> trial(pop.pop_size(), pop.dim());
+  if (!resumed || condition(pop, alg)) {
+    do {
+      de_iterate_async<Use_Archive>(config, pop, trial, parents, f, lb, ub,
+                                    alg, ev, in_flight);
+      checkpoint_scope::save(alg.current_iterator(), alg, pop, config);
+    } while (condition(pop, alg));
+  }
+  checkpoint_scope::save(-1, alg, pop, config);
+}
+} // namespace detail
+} // namespace sevobench::de_module
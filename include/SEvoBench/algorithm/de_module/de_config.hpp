@@ -8,8 +8,83 @@
 #include "de_parameter.hpp"
 #include "de_population.hpp"
 #include <memory>
+#include <vector>
 
 namespace sevobench::de_module {
+namespace detail {
+using sevobench::detail::module_ref;
+using sevobench::detail::no_module;
+
+template <bool Use_Archive, std::floating_point T>
+inline void de_iterate(auto &c, auto &&pop, auto &&trial, auto &&f, T lb,
+                       T ub, evolutionary_algorithm &alg) noexcept {
+  auto &parameter = module_ref(c.parameter);
+  auto &mutation = module_ref(c.mutation);
+  auto &constraint_handler = module_ref(c.constraint_handler);
+  auto &crossover = module_ref(c.crossover);
+  auto &population_strategy = module_ref(c.population_strategy);
+  [[maybe_unused]] auto &archive = module_ref(c.archive);
+  auto &fs = c.fs;
+  auto &crs = c.crs;
+  auto &base = c.base;
+  parameter.prepare(pop);
+  mutation.prepare(pop);
+  crossover.prepare(pop);
+  const auto n = static_cast<std::size_t>(pop.pop_size());
+  fs.resize(n);
+  crs.resize(n);
+  base.resize(n);
+  parameter.get_all(fs, crs);
+  if constexpr (Use_Archive) {
+    mutation.mutate_all(trial, pop, archive.get(), fs, base);
+  } else {
+    mutation.mutate_all(trial, pop, fs, base);
+  }
+  constraint_handler.repair_all(trial, lb, ub, pop, base);
+  // Individuals the handler rejects are resampled one at a time.
+  for (int i = 0; i < pop.pop_size(); i++)
+    while (!constraint_handler.is_repair(trial[i], lb, ub, pop[base[i]],
+                                         pop[i])) {
+      if constexpr (Use_Archive) {
+        mutation.mutate(trial[i], pop, archive.get(), fs[i], i);
+      } else {
+        mutation.mutate(trial[i], pop, fs[i], i);
+      }
+      base[i] = mutation.base_index(i);
+      constraint_handler.repair(trial[i], lb, ub, pop[base[i]], pop[i]);
+    }
+  crossover.crossover_all(trial, pop, crs);
+  evaluate_population(trial, f, pop.pop_size());
+  alg.add_fes(pop.pop_size());
+  parameter.update(pop, trial);
+  for (int i = 0; i < pop.pop_size(); i++)
+    if (trial[i].fitness() < pop[i].fitness()) {
+      std::ranges::swap(trial[i], pop[i]);
+      if constexpr (Use_Archive) {
+        archive.add(trial[i]);
+      }
+    }
+  population_strategy.resize(pop);
+  alg.set_pop_size(pop.pop_size());
+  if constexpr (Use_Archive) {
+    archive.resize(pop);
+  }
+  alg.increment_iterator();
+}
+
+template <bool Use_Archive>
+inline void de_serialize(auto &c, checkpoint &ar) noexcept {
+  module_ref(c.parameter).serialize(ar);
+  module_ref(c.mutation).serialize(ar);
+  module_ref(c.constraint_handler).serialize(ar);
+  module_ref(c.crossover).serialize(ar);
+  module_ref(c.population_strategy).serialize(ar);
+  if constexpr (Use_Archive) {
+    module_ref(c.archive).serialize(ar);
+  }
+}
+} // namespace detail
+
 template <bool Use_Archive, std::floating_point T> struct de_config {
   std::unique_ptr<de_parameter<T>> parameter;
   std::unique_ptr<de_mutation<T>> mutation;
@@ -19,41 +94,46 @@ template <bool Use_Archive, std::floating_point T> struct de_config {
   std::conditional_t<Use_Archive, std::unique_ptr<de_archive<T>>, void *>
       archive;
 
+  std::vector<T> fs;
+  std::vector<T> crs;
+  std::vector<int> base;
+
   void iterator(auto &&pop, auto &&trial, auto &&f, T lb, T ub,
                 evolutionary_algorithm &alg) noexcept {
-    parameter->prepare(pop);
-    mutation->prepare(pop);
-    crossover->prepare(pop);
-    for (int i = 0; i < pop.pop_size(); i++) {
-      do {
-        if constexpr (Use_Archive) {
-          mutation->mutate(trial[i], pop, archive->get(), parameter->get_f(i),
-                           i);
-        } else {
-          mutation->mutate(trial[i], pop, parameter->get_f(i), i);
-        }
-        constraint_handler->repair(trial[i], lb, ub,
-                                   pop[mutation->base_index(i)], pop[i]);
-      } while (!constraint_handler->is_repair(
-          trial[i], lb, ub, pop[mutation->base_index(i)], pop[i]));
-      crossover->crossover(trial[i], pop[i], parameter->get_cr(i));
-      trial[i].evaluate(f);
-      alg.increment_fes();
-    }
-    parameter->update(pop, trial);
-    for (int i = 0; i < pop.pop_size(); i++)
-      if (trial[i].fitness() < pop[i].fitness()) {
-        std::swap(trial[i], pop[i]);
-        if constexpr (Use_Archive) {
-          archive->add(trial[i]);
-        }
-      }
-    population_strategy->resize(pop);
-    alg.set_pop_size(pop.pop_size());
-    if constexpr (Use_Archive) {
-      archive->resize(pop);
-    }
-    alg.increment_iterator();
+    detail::de_iterate<Use_Archive>(*this, pop, trial, f, lb, ub, alg);
+  }
+
+  void serialize(checkpoint &ar) noexcept {
+    detail::de_serialize<Use_Archive>(*this, ar);
+  }
+};
+
+// Compile-time composition: every module is held by value with its concrete
+// type, so the generation loop calls, and can inline, the modules directly.
+template <std::floating_point T, typename P, typename M, typename C,
+          typename X, typename S, typename A = detail::no_module>
+struct static_de_config {
+  using value_type = T;
+  static constexpr bool use_archive = !std::is_same_v<A, detail::no_module>;
+
+  P parameter;
+  M mutation;
+  C constraint_handler;
+  X crossover;
+  S population_strategy;
+  [[no_unique_address]] A archive;
+
+  std::vector<T> fs;
+  std::vector<T> crs;
+  std::vector<int> base;
+
+  void iterator(auto &&pop, auto &&trial, auto &&f, T lb, T ub,
+                evolutionary_algorithm &alg) noexcept {
+    detail::de_iterate<use_archive>(*this, pop, trial, f, lb, ub, alg);
+  }
+
+  void serialize(checkpoint &ar) noexcept {
+    detail::de_serialize<use_archive>(*this, ar);
   }
 };
 } // namespace sevobench::de_module
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../../common/tool.hpp"
 #include <memory>
@@ -16,9 +17,30 @@ public:
     return true;
   }
 
+  // Repairs trial[i] against base pop[base[i]] and target pop[i] for every
+  // i < pop.pop_size().
+  virtual void repair_all(population<T> &trial, T lb, T ub,
+                          const population<T> &pop, std::span<const int> base) {
+    for (int i = 0; i < pop.pop_size(); i++)
+      repair(trial[i], lb, ub, pop[base[i]], pop[i]);
+  }
+
+  virtual void serialize(checkpoint &) {}
+
   virtual ~de_constraint() = default;
 };
 
+namespace detail {
+// Branch-free form of the midpoint repairs, so the row loop vectorizes.
+template <std::floating_point T>
+inline void midpoint_repair(T *p, const T *r, T lb, T ub, int dim) noexcept {
+  for (int i = 0; i < dim; i++)
+    p[i] = p[i] < lb   ? T(0.5) * (lb + r[i])
+           : p[i] > ub ? T(0.5) * (ub + r[i])
+                       : p[i];
+}
+} // namespace detail
+
 template <std::floating_point T, typename R = tool::rng>
   requires tool::random_generator_concept<R, T>
 
@@ -26,6 +48,8 @@ class reinitialization_repair final : public de_constraint<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void repair(std::span<T> p, T lb, T ub, std::span<const T>,
               std::span<const T>) override {
     for (auto &x : p)
@@ -42,6 +66,15 @@ public:
     for (auto &x : p)
       x = std::clamp(x, lb, ub);
   }
+
+  void repair_all(population<T> &trial, T lb, T ub, const population<T> &pop,
+                  std::span<const int>) override {
+    for (int i = 0; i < pop.pop_size(); i++) {
+      T *x = trial[i].data();
+      for (int j = 0; j < pop.dim(); j++)
+        x[j] = std::clamp(x[j], lb, ub);
+    }
+  }
 };
 
 template <std::floating_point T>
@@ -67,6 +100,8 @@ class rand_base_repair final : public de_constraint<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void repair(std::span<T> p, T lb, T ub, std::span<const T> base,
               std::span<const T>) override {
     for (std::size_t i = 0; i < p.size(); i++) {
@@ -93,6 +128,13 @@ public:
       }
     }
   }
+
+  void repair_all(population<T> &trial, T lb, T ub, const population<T> &pop,
+                  std::span<const int> base) override {
+    for (int i = 0; i < pop.pop_size(); i++)
+      detail::midpoint_repair(trial[i].data(), pop[base[i]].data(), lb, ub,
+                              pop.dim());
+  }
 };
 
 template <std::floating_point T>
@@ -109,6 +151,13 @@ public:
       }
     }
   }
+
+  void repair_all(population<T> &trial, T lb, T ub, const population<T> &pop,
+                  std::span<const int>) override {
+    for (int i = 0; i < pop.pop_size(); i++)
+      detail::midpoint_repair(trial[i].data(), pop[i].data(), lb, ub,
+                              pop.dim());
+  }
 };
 
 template <std::floating_point T>
@@ -139,6 +188,8 @@ public:
       }
     return true;
   }
+
+  void serialize(checkpoint &ar) override { ch->serialize(ar); }
 };
 
 } // namespace sevobench::de_module
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../../common/tool.hpp"
 
@@ -11,6 +12,15 @@ public:
 
   virtual void prepare(const population<T> &) {};
 
+  // Crosses trial[i] with pop[i] at rate crs[i] for every i < pop.pop_size().
+  virtual void crossover_all(population<T> &trial, const population<T> &pop,
+                             std::span<const T> crs) {
+    for (int i = 0; i < pop.pop_size(); i++)
+      crossover(trial[i], pop[i], crs[i]);
+  }
+
+  virtual void serialize(checkpoint &) {}
+
   virtual ~de_crossover() {};
 };
 
@@ -18,15 +28,39 @@ template <std::floating_point T, typename R = tool::rng>
   requires tool::random_generator_concept<R, T>
 
 class binomial_crossover final : public de_crossover<T> {
+  std::vector<T> r;
+
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void crossover(std::span<T> donor, std::span<const T> target, T cr) override {
     auto dim = static_cast<int>(target.size());
     auto j = RNG.rand_int(dim);
+    r.resize(dim);
+    tool::fill_uniform(RNG, std::span<T>(r));
     for (int i = 0; i < dim; i++)
-      donor[i] =
-          (RNG.template rand_float<T>() < cr || i == j) ? donor[i] : target[i];
+      donor[i] = (r[i] < cr || i == j) ? donor[i] : target[i];
+  }
+
+  void crossover_all(population<T> &trial, const population<T> &pop,
+                     std::span<const T> crs) override {
+    const int n = pop.pop_size();
+    const int dim = pop.dim();
+    r.resize(std::size_t(n) * dim);
+    tool::fill_uniform(RNG, std::span<T>(r));
+    for (int i = 0; i < n; i++) {
+      const T *u = r.data() + std::size_t(i) * dim;
+      const T *x = pop[i].data();
+      T *y = trial[i].data();
+      const T cr = crs[i];
+      const auto j = RNG.rand_int(dim);
+      const auto kept = y[j];
+      for (int k = 0; k < dim; k++)
+        y[k] = u[k] < cr ? y[k] : x[k];
+      y[j] = kept;
+    }
   }
 };
 
@@ -37,6 +71,8 @@ class exponential_crossover final : public de_crossover<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void crossover(std::span<T> donor, std::span<const T> target, T cr) override {
     auto dim = static_cast<int>(target.size());
     int start = RNG.rand_int(dim);
@@ -71,6 +107,7 @@ public:
         R RNG;
         R RNG1;
         R RNG2;
+        void serialize(checkpoint &ar) override { ar(RNG, RNG1, RNG2); }
         cauchy_pertubation(T _lb,T _ub,T _pr=T(0.2)):lb(_lb),ub(_ub),pr(_pr) {}
         void crossover(std::span<T> donor, std::span<const T> target, T cr) override {
             auto dim = static_cast<int>(target.size());
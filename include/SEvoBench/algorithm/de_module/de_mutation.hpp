@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../evolutionary_algorithm.hpp"
 
@@ -17,20 +18,81 @@ public:
     mutate(trial, pop, f, i);
   };
 
+  // Whole-population entry points: trial[i] is mutated with fs[i] for every
+  // i < pop.pop_size() and base[i] receives its base_index(i).
+  virtual void mutate_all(population<T> &trial, const population<T> &pop,
+                          std::span<const T> fs, std::span<int> base) {
+    for (int i = 0; i < pop.pop_size(); i++) {
+      mutate(trial[i], pop, fs[i], i);
+      base[i] = base_index(i);
+    }
+  }
+
+  virtual void mutate_all(population<T> &trial, const population<T> &pop,
+                          std::span<const solution<T>> archives,
+                          std::span<const T> fs, std::span<int> base) {
+    for (int i = 0; i < pop.pop_size(); i++) {
+      mutate(trial[i], pop, archives, fs[i], i);
+      base[i] = base_index(i);
+    }
+  }
+
   virtual ~de_mutation() = default;
 
   virtual int base_index(int i) { return i; }
+
+  // Visits the state carried from one generation to the next.
+  virtual void serialize(checkpoint &) {}
 };
 
+namespace detail {
+// The batched mutations draw every index first and then run these kernels
+// back to back, so the row loops carry no RNG or virtual calls.
+template <std::floating_point T>
+inline void rand_difference(T *y, const T *a, const T *b, const T *c, T f,
+                            int dim) noexcept {
+  for (int j = 0; j < dim; j++)
+    y[j] = a[j] + f * (b[j] - c[j]);
+}
+
+template <std::floating_point T>
+inline void current_to_pbest(T *y, const T *x, const T *p, const T *b,
+                             const T *c, T f, T w, int dim) noexcept {
+  for (int j = 0; j < dim; j++)
+    y[j] = x[j] + f * (w * (p[j] - x[j]) + b[j] - c[j]);
+}
+
+inline auto pick_with_archive(auto &RNG, int i, int n, int a) noexcept {
+  int r1, r2;
+  do {
+    r1 = RNG.rand_int(n);
+  } while (r1 == i);
+  do {
+    r2 = RNG.rand_int(n + a);
+  } while (r2 == i || r2 == r1);
+  return std::array<int, 2>{r1, r2};
+}
+
+template <std::floating_point T>
+inline auto row(const population<T> &pop,
+                std::span<const solution<T>> archives, int r) noexcept {
+  return r >= pop.pop_size() ? archives[r - pop.pop_size()].data()
+                             : pop[r].data();
+}
+} // namespace detail
+
 template <std::floating_point T, typename R = tool::rng>
   requires tool::random_generator_concept<R, T>
 
 class rand1_mutation final : public de_mutation<T> {
   int index;
+  std::vector<std::array<int, 3>> picks;
 
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void mutate(solution<T> &trial, const population<T> &pop, T f,
               int i) override {
     auto [r1, r2, r3] = RNG.template pick_random<3>(pop.pop_size(), i);
@@ -41,6 +103,20 @@ public:
   }
 
   int base_index(int) override { return index; }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    picks.resize(n);
+    for (int i = 0; i < n; i++)
+      picks[i] = RNG.template pick_random<3>(n, i);
+    for (int i = 0; i < n; i++) {
+      auto [r1, r2, r3] = picks[i];
+      base[i] = index = r1;
+      detail::rand_difference(trial[i].data(), pop[r1].data(), pop[r2].data(),
+                              pop[r3].data(), fs[i], pop.dim());
+    }
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -52,6 +128,8 @@ class rand2_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void mutate(solution<T> &trial, const population<T> &pop, T f,
               int i) override {
     auto [r1, r2, r3, r4, r5] = RNG.template pick_random<5>(pop.pop_size(), i);
@@ -70,10 +148,13 @@ template <std::floating_point T, typename R = tool::rng>
 
 class best1_mutation final : public de_mutation<T> {
   int index;
+  std::vector<std::array<int, 2>> picks;
 
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void prepare(population<T> &pop) override {
     index =
         static_cast<int>(std::min_element(pop.begin(), pop.end(),
@@ -92,6 +173,21 @@ public:
   }
 
   int base_index(int) override { return index; }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    picks.resize(n);
+    for (int i = 0; i < n; i++)
+      picks[i] = RNG.template pick_random<2>(n, i);
+    std::fill_n(base.begin(), n, index);
+    for (int i = 0; i < n; i++) {
+      auto [r1, r2] = picks[i];
+      detail::rand_difference(trial[i].data(), pop[index].data(),
+                              pop[r1].data(), pop[r2].data(), fs[i],
+                              pop.dim());
+    }
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -103,6 +199,8 @@ class best2_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void prepare(population<T> &pop) override {
     index =
         static_cast<int>(std::min_element(pop.begin(), pop.end(),
@@ -129,11 +227,14 @@ template <std::floating_point T, typename R = tool::rng>
 
 class ttpb1_mutation final : public de_mutation<T> {
   const T p;
-  int P;
+  int P = 0;
+  std::vector<std::array<int, 3>> picks;
 
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   ttpb1_mutation(T _p = T(0.11)) : p(_p) {}
 
   void prepare(population<T> &pop) override {
@@ -169,6 +270,44 @@ public:
       trial[j] = pop[i][j] + f * (pop[r0][j] - pop[i][j] + pop[r1][j] - tmp[j]);
     }
   }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    picks.resize(n);
+    for (int i = 0; i < n; i++) {
+      auto r0 = RNG.rand_int(P);
+      auto [r1, r2] = RNG.template pick_random<2>(n, i);
+      picks[i] = {r0, r1, r2};
+    }
+    for (int i = 0; i < n; i++) {
+      auto [r0, r1, r2] = picks[i];
+      base[i] = i;
+      detail::current_to_pbest(trial[i].data(), pop[i].data(), pop[r0].data(),
+                               pop[r1].data(), pop[r2].data(), fs[i], T(1),
+                               pop.dim());
+    }
+  }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const solution<T>> archives,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    const int a = static_cast<int>(archives.size());
+    picks.resize(n);
+    for (int i = 0; i < n; i++) {
+      auto r0 = RNG.rand_int(P);
+      auto [r1, r2] = detail::pick_with_archive(RNG, i, n, a);
+      picks[i] = {r0, r1, r2};
+    }
+    for (int i = 0; i < n; i++) {
+      auto [r0, r1, r2] = picks[i];
+      base[i] = i;
+      detail::current_to_pbest(trial[i].data(), pop[i].data(), pop[r0].data(),
+                               pop[r1].data(), detail::row(pop, archives, r2),
+                               fs[i], T(1), pop.dim());
+    }
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -180,6 +319,8 @@ class ttb1_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void prepare(population<T> &pop) override {
     index = int(std::min_element(pop.begin(), pop.end(),
                                  [](auto &x, auto &y) {
@@ -224,6 +365,8 @@ class ttb2_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void prepare(population<T> &pop) override {
     index = int(std::min_element(pop.begin(), pop.end(),
                                  [](auto &x, auto &y) {
@@ -251,6 +394,8 @@ class two_opt1_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void mutate(solution<T> &trial, const population<T> &pop, T f,
               int i) override {
     auto [r0, r1, r2] = RNG.template pick_random<3>(pop.pop_size(), i);
@@ -274,6 +419,8 @@ class two_opt2_mutation final : public de_mutation<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void mutate(solution<T> &trial, const population<T> &pop, T f,
               int i) override {
     auto [r0, r1, r2, r3, r4] = RNG.template pick_random<5>(pop.pop_size(), i);
@@ -296,11 +443,21 @@ class ttpb1_weight_mutation final : public de_mutation<T> {
   const evolutionary_algorithm &alg;
   const T p_min;
   const T p_max;
-  int P;
+  int P = 0;
+  std::vector<std::array<int, 3>> picks;
+
+  auto weight() const noexcept {
+    return alg.current_fes() < alg.max_fes() / 5
+               ? T(0.7)
+               : (alg.current_fes() < (2 * alg.max_fes() / 5) ? T(0.8)
+                                                              : T(1.2));
+  }
 
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   ttpb1_weight_mutation(const evolutionary_algorithm &_alg, T _p_min, T _p_max)
       : alg(_alg), p_min(_p_min), p_max(_p_max) {}
 
@@ -347,6 +504,46 @@ public:
                  f * (weight * (pop[r0][j] - pop[i][j]) + pop[r1][j] - tmp[j]);
     }
   }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    picks.resize(n);
+    for (int i = 0; i < n; i++) {
+      auto r0 = RNG.rand_int(P);
+      auto [r1, r2] = RNG.template pick_random<2>(n, i);
+      picks[i] = {r0, r1, r2};
+    }
+    const auto w = weight();
+    for (int i = 0; i < n; i++) {
+      auto [r0, r1, r2] = picks[i];
+      base[i] = i;
+      detail::current_to_pbest(trial[i].data(), pop[i].data(), pop[r0].data(),
+                               pop[r1].data(), pop[r2].data(), fs[i], w,
+                               pop.dim());
+    }
+  }
+
+  void mutate_all(population<T> &trial, const population<T> &pop,
+                  std::span<const solution<T>> archives,
+                  std::span<const T> fs, std::span<int> base) override {
+    const int n = pop.pop_size();
+    const int a = static_cast<int>(archives.size());
+    picks.resize(n);
+    for (int i = 0; i < n; i++) {
+      auto r0 = RNG.rand_int(P);
+      auto [r1, r2] = detail::pick_with_archive(RNG, i, n, a);
+      picks[i] = {r0, r1, r2};
+    }
+    const auto w = weight();
+    for (int i = 0; i < n; i++) {
+      auto [r0, r1, r2] = picks[i];
+      base[i] = i;
+      detail::current_to_pbest(trial[i].data(), pop[i].data(), pop[r0].data(),
+                               pop[r1].data(), detail::row(pop, archives, r2),
+                               fs[i], w, pop.dim());
+    }
+  }
 };
 
 } // namespace sevobench::de_module
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/tool.hpp"
 #include "../evolutionary_algorithm.hpp"
 
@@ -15,6 +16,16 @@ public:
 
   virtual T get_cr(int) = 0;
 
+  // Fills F and CR for the whole population at once.
+  virtual void get_all(std::span<T> fs, std::span<T> crs) {
+    for (int i = 0; i < static_cast<int>(fs.size()); i++) {
+      fs[i] = get_f(i);
+      crs[i] = get_cr(i);
+    }
+  }
+
+  virtual void serialize(checkpoint &) {}
+
   virtual ~de_parameter() {};
 };
 
@@ -96,17 +107,18 @@ inline void jade_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
 
     noexcept {
   const int size = pop.pop_size();
-  auto gen_f = [&](auto x) {
+  auto gen_f = [&](auto x, T z) {
     if (!std::isfinite(x))
       return T(1);
-    auto z = RNG.cauchy(x, T(0.1));
     while (z <= 0)
       z = RNG.cauchy(x, T(0.1));
     return z < 1 ? z : 1;
   };
+  tool::fill_normal(RNG, std::span<T>(CRs.data(), size), cr_, T(0.1));
+  tool::fill_cauchy(RNG, std::span<T>(Fs.data(), size), f_, T(0.1));
   for (int i = 0; i < size; i++) {
-    CRs[i] = std::clamp(RNG.normal(cr_, T(0.1)), T(0), T(1));
-    Fs[i] = gen_f(f_);
+    CRs[i] = std::clamp(CRs[i], T(0), T(1));
+    Fs[i] = gen_f(f_, Fs[i]);
   }
 }
 
@@ -116,10 +128,10 @@ inline void shade_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
 
     noexcept {
   const int size = pop.pop_size();
-  auto gen_f = [&](auto x) {
+  auto gen_f = [&](auto x, T z) {
     if (!std::isfinite(x))
       return T(1);
-    auto z = RNG.cauchy(x, T(0.1));
+    z = x + T(0.1) * z;
     constexpr int sample_max = 20;
     for (int i = 0; z <= T(0); i++) {
       z = RNG.cauchy(x, T(0.1));
@@ -128,12 +140,14 @@ inline void shade_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
     }
     return z < 1 ? z : T(1);
   };
+  tool::fill_normal(RNG, std::span<T>(CRs.data(), size));
+  tool::fill_cauchy(RNG, std::span<T>(Fs.data(), size));
   for (int i = 0; i < size; i++) {
     auto rp = RNG.rand_int(memory_size);
     CRs[i] = (MCR[rp] == T(-1)
                   ? T(0)
-                  : std::clamp(RNG.normal(MCR[rp], T(0.1)), T(0), T(1)));
-    Fs[i] = gen_f(MF[rp]);
+                  : std::clamp(MCR[rp] + T(0.1) * CRs[i], T(0), T(1)));
+    Fs[i] = gen_f(MF[rp], Fs[i]);
   }
 }
 
@@ -144,10 +158,10 @@ inline void jso_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
 
     noexcept {
   const auto size = pop.pop_size();
-  auto gen_f = [&](auto x) {
+  auto gen_f = [&](auto x, T z) {
     if (!std::isfinite(x))
       return T(1);
-    auto z = RNG.cauchy(x, T(0.1));
+    z = x + T(0.1) * z;
     constexpr int sample_max = 20;
     for (int i = 0; z <= T(0); i++) {
       z = RNG.cauchy(x, T(0.1));
@@ -156,6 +170,8 @@ inline void jso_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
     }
     return z < 1 ? z : T(1);
   };
+  tool::fill_normal(RNG, std::span<T>(CRs.data(), size));
+  tool::fill_cauchy(RNG, std::span<T>(Fs.data(), size));
   for (int i = 0; i < size; i++) {
     auto rp = RNG.rand_int(memory_size);
     if (rp == memory_size - 1) {
@@ -164,7 +180,7 @@ inline void jso_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
     }
     auto tmp_cr = (MCR[rp] == T(-1)
                        ? T(0)
-                       : std::clamp(RNG.normal(MCR[rp], T(0.1)), T(0), T(1)));
+                       : std::clamp(MCR[rp] + T(0.1) * CRs[i], T(0), T(1)));
     if (alg.
 
         current_fes()
@@ -187,7 +203,7 @@ inline void jso_prepare(const population<T> &pop, auto &&Fs, auto &&CRs,
       tmp_cr = std::max(T(0.6), tmp_cr);
     }
     CRs[i] = tmp_cr;
-    auto tmp_f = gen_f(MF[rp]);
+    auto tmp_f = gen_f(MF[rp], Fs[i]);
     if (tmp_f > T(0.7) && alg.
 
                               current_fes()
@@ -254,12 +270,19 @@ public:
 
   T get_cr(int i) override { return CRs[i]; }
 
+  void get_all(std::span<T> fs, std::span<T> crs) override {
+    std::copy_n(Fs.begin(), fs.size(), fs.begin());
+    std::copy_n(CRs.begin(), crs.size(), crs.begin());
+  }
+
   void reset()
 
       noexcept {
     cr_ = init_cr;
     f_ = init_f;
   }
+
+  void serialize(checkpoint &ar) override { ar(cr_, f_, RNG); }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -316,6 +339,11 @@ public:
 
   T get_cr(int i) override { return CRs[i]; }
 
+  void get_all(std::span<T> fs, std::span<T> crs) override {
+    std::copy_n(Fs.begin(), fs.size(), fs.begin());
+    std::copy_n(CRs.begin(), crs.size(), crs.begin());
+  }
+
   void reset()
 
       noexcept {
@@ -323,6 +351,10 @@ public:
     std::fill(MCR.begin(), MCR.end(), memory_cr);
     std::fill(MF.begin(), MF.end(), memory_f);
   }
+
+  void serialize(checkpoint &ar) override {
+    ar(MF, MCR, index_counter, RNG);
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -354,6 +386,11 @@ public:
   T get_f(int) override { return f; }
 
   T get_cr(int) override { return cr; }
+
+  void get_all(std::span<T> fs, std::span<T> crs) override {
+    std::fill(fs.begin(), fs.end(), f);
+    std::fill(crs.begin(), crs.end(), cr);
+  }
 };
 
 template <std::floating_point T, typename R = tool::rng>
@@ -399,6 +436,10 @@ public:
     f = init_f;
     cr = init_cr;
   }
+
+  void serialize(checkpoint &ar) override {
+    ar(f, cr, RNG1, RNG2, RNG3, RNG4);
+  }
 };
 
 } // namespace sevobench::de_module
@@ -1,6 +1,7 @@
 
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../evolutionary_algorithm.hpp"
 
@@ -9,6 +10,8 @@ template <std::floating_point T> class de_population {
 public:
   virtual void resize(population<T> &) {};
 
+  virtual void serialize(checkpoint &) {}
+
   virtual ~de_population() {}
 };
 
@@ -2,6 +2,20 @@
 #pragma once
 
 namespace sevobench {
+namespace detail {
+// Marks an unset slot of the static (compile-time) algorithm builders.
+struct no_module {};
+
+// Modules are held either by unique_ptr (runtime builders) or by value
+// (static builders); the generation loops see both as plain references.
+template <typename M> inline auto &module_ref(M &m) noexcept {
+  if constexpr (requires { m.get(); *m; })
+    return *m;
+  else
+    return m;
+}
+} // namespace detail
+
 class evolutionary_algorithm {
 protected:
   int ite = 0;
@@ -112,6 +126,9 @@ public:
       noexcept {
     return fes += _fes;
   }
+
+  // The budget is left to whoever resumes the run.
+  void serialize(auto &ar) noexcept { ar(ite, fes, ps, d); }
 };
 
 struct evolutionary_algorithm_condition {
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "../../common/population.hpp"
+#include "../evolutionary_algorithm.hpp"
+#include "island_topology.hpp"
+#include "island_transport.hpp"
+#include <memory>
+#include <numeric>
+#include <thread>
+
+namespace sevobench::island_module {
+struct island_config {
+  int islands = 4;
+  // Iterations between two migrations of an island.
+  int interval = 10;
+  // Best individuals sent per migration.
+  int migrants = 1;
+  // Migrants buffered per edge; further ones are dropped.
+  int capacity = 4;
+};
+
+// Stopping condition of one island that migrates every interval iterations:
+// it sends its best individuals to its out-neighbors, then lets every
+// migrant waiting for it replace its worst individual if the migrant is
+// better. Stops at max_fes like the default condition.
+//
+// A PSO island moves every particle before evaluating it, so a migrant put
+// into the swarm would be lost; pass its topology as well, and migrants are
+// offered to it as personal bests (pso_topology::inject) instead.
+template <std::floating_point T> class island_migration {
+  island_transport<T> *transport;
+  const std::vector<int> *out;
+  int id;
+  int interval;
+  int migrants;
+  bool broadcast;
+  int received_ = 0;
+  tool::rng RNG;
+  std::vector<int> order;
+  solution<T> buf;
+
+public:
+  island_migration(island_transport<T> &_transport,
+                   const std::vector<int> &_out, int _id,
+                   const island_config &config, bool _broadcast) noexcept
+      : transport(&_transport), out(&_out), id(_id),
+        interval(config.interval), migrants(config.migrants),
+        broadcast(_broadcast) {}
+
+  auto received() const noexcept { return received_; }
+
+  // Hands every migrant waiting for this island to accept(x, fitness).
+  void migrate(population<T> &pop, auto &&accept) noexcept {
+    const int n = pop.pop_size();
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0);
+    const int k = std::min(migrants, n);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                      [&](int a, int b) {
+                        return pop[a].fitness() < pop[b].fitness();
+                      });
+    for (int m = 0; m < k; m++) {
+      const auto &x = pop[order[m]];
+      if (broadcast) {
+        for (int to : *out)
+          transport->send(id, to, x, x.fitness());
+      } else if (!out->empty()) {
+        const int to = (*out)[RNG.rand_int(static_cast<int>(out->size()))];
+        transport->send(id, to, x, x.fitness());
+      }
+    }
+    buf.resize(pop.dim());
+    T fitness;
+    while (transport->receive(id, buf, fitness)) {
+      received_++;
+      accept(std::span<const T>(buf), fitness);
+    }
+  }
+
+  void migrate(population<T> &pop) noexcept {
+    migrate(pop, [&](std::span<const T> x, T fitness) {
+      auto worst = std::ranges::max_element(
+          pop, {}, [](const auto &s) { return s.fitness(); });
+      if (fitness < worst->fitness()) {
+        std::ranges::copy(x, worst->begin());
+        worst->set_fitness(fitness);
+      }
+    });
+  }
+
+  bool operator()(population<T> &pop,
+                  const evolutionary_algorithm &alg) noexcept {
+    if (interval > 0 && alg.current_iterator() % interval == 0)
+      migrate(pop);
+    return alg.current_fes() < alg.max_fes();
+  }
+
+  bool operator()(population<T> &pop, const evolutionary_algorithm &alg,
+                  auto &topology) noexcept
+    requires requires(std::span<const T> x, T fitness) {
+      topology.inject(x, fitness);
+    }
+  {
+    if (interval > 0 && alg.current_iterator() % interval == 0)
+      migrate(pop, [&](std::span<const T> x, T fitness) {
+        topology.inject(x, fitness);
+      });
+    return alg.current_fes() < alg.max_fes();
+  }
+};
+
+// Runs one optimizer per island, each on its own thread, passing it the
+// island_migration to use as its stopping condition:
+//
+//   model.run([&](int id, auto migrate) {
+//     auto pop = ...;
+//     algorithm.run(pop, f, lb, ub, alg, migrate);
+//   });
+//
+// A PSO island passes its topology too: migrate(pop, alg, *pso.topology()).
+//
+// With shm_transport, each process of a node runs its own range of islands
+// over the same segment. run() refuses a transport that is not valid().
+template <std::floating_point T> class island_model {
+  island_config config_;
+  std::unique_ptr<island_topology> topology_;
+  std::vector<std::vector<int>> neighbors_;
+  std::unique_ptr<island_transport<T>> transport_;
+
+public:
+  island_model(const island_config &config, int dim,
+               std::unique_ptr<island_topology> topology =
+                   std::make_unique<ring_topology>())
+      : config_(config), topology_(std::move(topology)),
+        neighbors_(topology_->neighbors(config.islands)),
+        transport_(std::make_unique<in_process_transport<T>>(
+            neighbors_, dim, config.capacity)) {}
+
+  // The transport must have been built over neighbors(config.islands) of
+  // the same topology.
+  island_model(const island_config &config,
+               std::unique_ptr<island_topology> topology,
+               std::unique_ptr<island_transport<T>> transport)
+      : config_(config), topology_(std::move(topology)),
+        neighbors_(topology_->neighbors(config.islands)),
+        transport_(std::move(transport)) {}
+
+  const auto &config() const noexcept { return config_; }
+  const auto &neighbors() const noexcept { return neighbors_; }
+  auto &transport() noexcept { return *transport_; }
+
+  auto migration(int id) noexcept {
+    return island_migration<T>(*transport_, neighbors_[id], id, config_,
+                               topology_->broadcast());
+  }
+
+  auto valid() const noexcept { return transport_ && transport_->valid(); }
+
+  // Runs island(id, migration(id)) for the islands in [first, last), last < 0
+  // meaning all of them, and returns when every one has finished; returns
+  // false without running any island if the transport is not valid.
+  bool run(auto &&island, int first = 0, int last = -1) noexcept {
+    if (!valid())
+      return false;
+    if (last < 0)
+      last = config_.islands;
+    std::vector<std::thread> threads;
+    threads.reserve(last - first);
+    for (int id = first; id < last; id++)
+      threads.emplace_back([&, id] { island(id, migration(id)); });
+    for (auto &_ : threads)
+      _.join();
+    return true;
+  }
+};
+} // namespace sevobench::island_module
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+namespace sevobench::island_module {
+// Directed migration graph between islands.
+class island_topology {
+public:
+  // Out-neighbors of every island of an n-island model.
+  virtual std::vector<std::vector<int>> neighbors(int n) const = 0;
+
+  // Whether a migration goes to every out-neighbor or to one at random.
+  virtual bool broadcast() const { return true; }
+
+  virtual ~island_topology() = default;
+};
+
+class ring_topology final : public island_topology {
+public:
+  std::vector<std::vector<int>> neighbors(int n) const override {
+    std::vector<std::vector<int>> out(n);
+    if (n > 1)
+      for (int i = 0; i < n; i++)
+        out[i].push_back((i + 1) % n);
+    return out;
+  }
+};
+
+// rows x (n / rows) grid with wrap-around; every island sends to its four
+// neighbors. rows = 0 picks the most square grid.
+class torus_topology final : public island_topology {
+  const int rows;
+
+public:
+  torus_topology(int _rows = 0) : rows(_rows) {}
+
+  std::vector<std::vector<int>> neighbors(int n) const override {
+    int r = rows;
+    if (r <= 0)
+      for (r = 1; (r + 1) * (r + 1) <= n; r++)
+        ;
+    while (n % r != 0)
+      r--;
+    const int c = n / r;
+    std::vector<std::vector<int>> out(n);
+    for (int i = 0; i < n; i++) {
+      const int y = i / c;
+      const int x = i % c;
+      for (int j : {((y + r - 1) % r) * c + x, ((y + 1) % r) * c + x,
+                    y * c + (x + c - 1) % c, y * c + (x + 1) % c})
+        if (j != i && std::ranges::find(out[i], j) == out[i].end())
+          out[i].push_back(j);
+    }
+    return out;
+  }
+};
+
+// Every migration goes to one island drawn uniformly from the others.
+class random_topology final : public island_topology {
+public:
+  std::vector<std::vector<int>> neighbors(int n) const override {
+    std::vector<std::vector<int>> out(n);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+        if (j != i)
+          out[i].push_back(j);
+    return out;
+  }
+
+  bool broadcast() const override { return false; }
+};
+} // namespace sevobench::island_module
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "../../common/tool.hpp"
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define SEVOBENCH_HAS_SHM_TRANSPORT 1
+#endif
+
+namespace sevobench::island_module {
+// Carries migrants along the edges of the migration graph. send() never
+// blocks: a migrant that does not fit is dropped.
+template <std::floating_point T> class island_transport {
+public:
+  virtual bool send(int from, int to, std::span<const T> x, T fitness) = 0;
+
+  // Takes one migrant addressed to island to, from any of its in-neighbors.
+  virtual bool receive(int to, std::span<T> x, T &fitness) = 0;
+
+  // Whether the transport can carry migrants at all.
+  virtual bool valid() const noexcept { return true; }
+
+  virtual ~island_transport() = default;
+};
+
+namespace detail {
+// Lock-free single-producer single-consumer ring of migrants stored as
+// [fitness, x...] in caller-provided memory, so that the same layout works
+// on the heap and in a shared memory segment.
+template <std::floating_point T> class spsc_ring {
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+  struct header {
+    alignas(tool::cache_line_size) std::atomic<std::uint64_t> head;
+    alignas(tool::cache_line_size) std::atomic<std::uint64_t> tail;
+  };
+
+  header *h = nullptr;
+  T *slots = nullptr;
+  int capacity = 0;
+  int width = 0;
+
+public:
+  static std::size_t bytes(int capacity, int dim) noexcept {
+    const auto data = std::size_t(capacity) * (dim + 1) * sizeof(T);
+    const auto line = tool::cache_line_size;
+    return sizeof(header) + (data + line - 1) / line * line;
+  }
+
+  spsc_ring() = default;
+  // init constructs the header; memory that is already zero (a fresh
+  // ftruncate'd segment) holds a valid empty ring either way.
+  spsc_ring(void *mem, int _capacity, int dim, bool init) noexcept
+      : capacity(_capacity), width(dim + 1) {
+    if (init)
+      ::new (mem) header();
+    h = std::launder(static_cast<header *>(mem));
+    slots = reinterpret_cast<T *>(static_cast<char *>(mem) + sizeof(header));
+  }
+
+  bool push(std::span<const T> x, T fitness) noexcept {
+    const auto t = h->tail.load(std::memory_order_relaxed);
+    if (t - h->head.load(std::memory_order_acquire) >=
+        std::uint64_t(capacity))
+      return false;
+    T *s = slots + std::size_t(t % capacity) * width;
+    s[0] = fitness;
+    std::copy_n(x.data(), width - 1, s + 1);
+    h->tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(std::span<T> x, T &fitness) noexcept {
+    const auto hd = h->head.load(std::memory_order_relaxed);
+    if (hd == h->tail.load(std::memory_order_acquire))
+      return false;
+    const T *s = slots + std::size_t(hd % capacity) * width;
+    fitness = s[0];
+    std::copy_n(s + 1, width - 1, x.data());
+    h->head.store(hd + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+// One spsc_ring per edge, laid out back to back in a single block.
+template <std::floating_point T>
+class ring_transport : public island_transport<T> {
+  std::vector<spsc_ring<T>> rings;
+  std::vector<std::vector<std::pair<int, int>>> outgoing;
+  std::vector<std::vector<int>> incoming;
+  std::vector<int> cursor;
+
+protected:
+  static std::size_t bytes(const std::vector<std::vector<int>> &neighbors,
+                           int dim, int capacity) noexcept {
+    std::size_t edges = 0;
+    for (auto &_ : neighbors)
+      edges += _.size();
+    return edges * spsc_ring<T>::bytes(capacity, dim);
+  }
+
+  void attach(void *mem, const std::vector<std::vector<int>> &neighbors,
+              int dim, int capacity, bool init) noexcept {
+    const int n = static_cast<int>(neighbors.size());
+    const auto step = spsc_ring<T>::bytes(capacity, dim);
+    outgoing.assign(n, {});
+    incoming.assign(n, {});
+    cursor.assign(n, 0);
+    auto *p = static_cast<char *>(mem);
+    for (int from = 0; from < n; from++)
+      for (int to : neighbors[from]) {
+        const int e = static_cast<int>(rings.size());
+        rings.emplace_back(p + e * step, capacity, dim, init);
+        outgoing[from].emplace_back(to, e);
+        incoming[to].push_back(e);
+      }
+  }
+
+  // False until attach(), and for an island outside the graph.
+  bool has(int island) const noexcept {
+    return island >= 0 && island < static_cast<int>(outgoing.size());
+  }
+
+public:
+  bool send(int from, int to, std::span<const T> x, T fitness) override {
+    if (!has(from))
+      return false;
+    for (auto [t, e] : outgoing[from])
+      if (t == to)
+        return rings[e].push(x, fitness);
+    return false;
+  }
+
+  // Polls the in-edges round-robin so that no neighbor is starved.
+  bool receive(int to, std::span<T> x, T &fitness) override {
+    if (!has(to))
+      return false;
+    const auto &in = incoming[to];
+    const int m = static_cast<int>(in.size());
+    for (int k = 0; k < m; k++) {
+      const int j = (cursor[to] + k) % m;
+      if (rings[in[j]].pop(x, fitness)) {
+        cursor[to] = (j + 1) % m;
+        return true;
+      }
+    }
+    return false;
+  }
+};
+} // namespace detail
+
+// Rings in process memory, for islands running as threads of one process.
+template <std::floating_point T>
+class in_process_transport final : public detail::ring_transport<T> {
+  tool::aligned_vector<char> memory;
+
+public:
+  in_process_transport(const std::vector<std::vector<int>> &neighbors,
+                       int dim, int capacity = 4)
+      : memory(this->bytes(neighbors, dim, capacity)) {
+    this->attach(memory.data(), neighbors, dim, capacity, true);
+  }
+};
+
+#ifdef SEVOBENCH_HAS_SHM_TRANSPORT
+// Rings in a named POSIX shared memory segment, for islands spread over
+// several processes of one node. Every process builds the transport with the
+// same neighbors, dim and capacity. The creating process replaces any stale
+// segment of that name and unlinks it on destruction; the others open it
+// after it exists, or inherit it across fork().
+template <std::floating_point T>
+class shm_transport final : public detail::ring_transport<T> {
+  std::string name;
+  void *mem = nullptr;
+  std::size_t size = 0;
+  bool owner = false;
+
+public:
+  shm_transport(std::string _name,
+                const std::vector<std::vector<int>> &neighbors, int dim,
+                int capacity, bool create)
+      : name(std::move(_name)), size(this->bytes(neighbors, dim, capacity)),
+        owner(create) {
+    if (create)
+      ::shm_unlink(name.c_str());
+    const int fd =
+        ::shm_open(name.c_str(), create ? O_CREAT | O_EXCL | O_RDWR : O_RDWR,
+                   0600);
+    if (fd < 0)
+      return;
+    if (create && ::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+      ::close(fd);
+      return;
+    }
+    void *p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+      return;
+    mem = p;
+    this->attach(mem, neighbors, dim, capacity, create);
+  }
+  shm_transport(const shm_transport &) = delete;
+  shm_transport &operator=(const shm_transport &) = delete;
+  ~shm_transport() {
+    if (mem)
+      ::munmap(mem, size);
+    if (owner)
+      ::shm_unlink(name.c_str());
+  }
+
+  bool valid() const noexcept override { return mem != nullptr; }
+};
+#endif
+} // namespace sevobench::island_module
@@ -113,7 +113,7 @@ namespace sevobench::other_algorithm {
     inline auto abc_optimize(G &&sol, F &&f, T d, T w,
                              const Parameter_Type &pt = Parameter_Type()) noexcept {
         tool::curve_t<Memory_Flag, T, Max> abc_convergence_curve;
-        std::random_device rd;
+        tool::seed_source rd;
         std::pair<std::array<T, Dim>, T> result{{}, {}};
         abc_detail::colony<Dim, Pop_Size, T> c(
                 rd(), d, w, static_cast<int>(pt.ratio * Dim * Pop_Size));
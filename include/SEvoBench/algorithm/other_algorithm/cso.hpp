@@ -35,7 +35,7 @@ namespace sevobench::other_algorithm {
         std::array<T, Dim> r2;
         std::array<T, Dim> r3;
         std::array<int, Pop_Size> index;
-        std::random_device rd;
+        tool::seed_source rd;
         std::default_random_engine gen(rd()), seed_gen(rd());
         std::uniform_int_distribution<unsigned int> seed(0, 0x7fff);
         tool::simple_rand sr1(rd());
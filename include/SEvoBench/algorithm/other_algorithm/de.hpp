@@ -33,7 +33,7 @@ namespace sevobench::other_algorithm {
         std::array<T, Pop_Size> fit;
         std::array<T, Pop_Size> tmp_fit;
         std::array<int, Dim> random_c;
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr1(rd()), sr2(rd());
         std::default_random_engine gen(rd());
         std::uniform_real_distribution<T> dis(l, r);
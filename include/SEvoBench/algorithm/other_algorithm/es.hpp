@@ -27,7 +27,7 @@ namespace sevobench::other_algorithm {
         T alpha = std::pow(T(2), T(1) / T(Dim));
         T beta = std::pow(T(2), T(-0.25) / T(Dim));
         T sigma = pt.sigma;
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr1(rd()), sr2(rd());
         std::array<T, Dim> tmp;
         tool::curve_t<Memory_Flag, T, Max> es_convergence_curve;
@@ -77,7 +77,7 @@ namespace sevobench::other_algorithm {
              typename Parameter_Type = es_parameter<T>>
     inline auto es(F &&function, T l, T r,
                    const Parameter_Type &pt = Parameter_Type()) noexcept {
-        std::random_device rd;
+        tool::seed_source rd;
         std::default_random_engine gen(rd());
         std::uniform_real_distribution<T> dis(l, r);
         std::array<T, Dim> sol;
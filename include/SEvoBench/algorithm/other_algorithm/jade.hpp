@@ -31,7 +31,7 @@ namespace sevobench::other_algorithm {
         constexpr T k = T(1) / T(0x7fff);
         T cr = 0.5;
         T f = 0.5;
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr1(rd()), sr2(rd()), sr3(rd()), sr4(rd()), sr5(rd());
         std::vector<std::array<T, Dim>> tmp(Pop_Size);
         std::vector<std::array<T, Dim>> Archive(Pop_Size);
@@ -38,7 +38,7 @@ namespace sevobench::other_algorithm {
         const T w_max = pt.w_max;
         const T w_min = pt.w_min;
         T v_max = (right_bound - left_bound) * pt.v_max_ratio;
-        std::random_device rd;
+        tool::seed_source rd;
         std::default_random_engine e(rd());
         tool::simple_rand sr1(rd());
         tool::simple_rand sr2(rd());
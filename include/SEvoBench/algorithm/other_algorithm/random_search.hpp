@@ -18,7 +18,7 @@ namespace sevobench::other_algorithm {
         requires algorithm_func_concept<Dim, Pop_Size, Max, F, T> &&
                  algorithm_vector_concept<F, G, T> && random_search_parameter_concept<Parameter_Type, T>
     inline auto random_search_optimize(G &&sol, F &&function, T l, T r, const Parameter_Type &pt = Parameter_Type()) noexcept {
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr(rd());
         tool::curve_t<Memory_Flag, T, Max> random_search_convergence_curve;
         auto fit = function(sol.data());
@@ -65,7 +65,7 @@ namespace sevobench::other_algorithm {
     inline auto random_search(
             F &&function, T l, T r,
             const Parameter_Type &_ = Parameter_Type()) noexcept {
-        std::random_device rd;
+        tool::seed_source rd;
         std::default_random_engine gen(rd());
         std::uniform_real_distribution<T> dis(l, r);
         std::array<T, Dim> sol;
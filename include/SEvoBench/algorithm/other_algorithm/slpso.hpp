@@ -45,7 +45,7 @@ namespace sevobench::other_algorithm {
             for (int i = 0; i < Pop_Size - 1; i++)
                 P[i] = std::pow(T(1) - q * T(i), alpha * std::log(std::ceil(T(Dim) * q)));
         std::iota(index.begin(), index.end(), 0);
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr1(rd());
         tool::simple_rand sr2(rd());
         tool::simple_rand sr3(rd());
@@ -54,7 +54,7 @@ namespace sevobench::other_algorithm {
         std::array<T, Pop_Size> pbest_fit;
         std::vector<std::array<int, K>> topology_index(Pop_Size);
         tool::curve_t<Memory_Flag, T, Max> template_pso_convergence_curve;
-        std::random_device rd;
+        tool::seed_source rd;
         std::default_random_engine gen(rd());
         std::uniform_real_distribution<T> dis(left_bound, right_bound);
         auto pbest(positions);
@@ -81,7 +81,7 @@ namespace sevobench::other_algorithm {
         std::vector<T> tmp_fit(Pop_Size);
         std::array<T, Dim> random_c;
         std::vector<int> index(Pop_Size);
-        std::random_device rd;
+        tool::seed_source rd;
         tool::simple_rand sr1(rd());
         tool::simple_rand sr2(rd());
         tool::simple_rand sr3(rd());
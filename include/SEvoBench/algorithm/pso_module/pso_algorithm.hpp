@@ -3,6 +3,32 @@
 #include "pso_config.hpp"
 
 namespace sevobench::pso_module {
+namespace detail {
+template <std::floating_point T>
+inline void pso_run(auto &config, auto &&pop, auto &&vec, auto &&f, T lb, T ub,
+                    evolutionary_algorithm &alg, auto condition,
+                    parallel_task *pool = nullptr) noexcept {
+  alg.set_pop_size(pop.pop_size());
+  alg.set_dim(pop.dim());
+  const bool resumed = checkpoint_scope::restore(alg, pop, vec, config);
+  if (!resumed) {
+    if (pool)
+      evaluate_population(pop, f, pop.pop_size(), *pool);
+    else
+      evaluate_population(pop, f, pop.pop_size());
+    alg.add_fes(pop.pop_size());
+    module_ref(config.topology).prepare(pop);
+  }
+  if (!resumed || condition(pop, alg)) {
+    do {
+      pso_iterate(config, pop, vec, f, lb, ub, alg, pool);
+      checkpoint_scope::save(alg.current_iterator(), alg, pop, vec, config);
+    } while (condition(pop, alg));
+  }
+  checkpoint_scope::save(-1, alg, pop, vec, config);
+}
+} // namespace detail
+
 template <std::floating_point T> class pso_algorithm {
   pso_config<T> config;
 
@@ -17,15 +43,7 @@ public:
            T ub, evolutionary_algorithm &alg, F condition = {})
 
       noexcept {
-    alg.set_pop_size(pop.pop_size());
-    alg.set_dim(pop.dim());
-    for (auto &_ : pop)
-      _.evaluate(f);
-    alg.add_fes(pop.pop_size());
-    config.topology->prepare(pop);
-    do {
-      config.iterator(pop, vec, f, lb, ub, alg);
-    } while (condition(pop, alg));
+    detail::pso_run(config, pop, vec, f, lb, ub, alg, condition);
   }
 
   template <typename F = evolutionary_algorithm_condition>
@@ -37,6 +55,25 @@ public:
     run(pop, vec, f, f.lower_bound(), f.upper_bound(), alg, condition);
   }
 
+  // run() with each generation's swarm evaluated in parallel chunks on pool;
+  // the result is the same as run() for a thread-safe f.
+  template <typename F = evolutionary_algorithm_condition>
+  void run_parallel(std::convertible_to<population<T>> auto &&pop,
+                    std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f,
+                    T lb, T ub, evolutionary_algorithm &alg,
+                    parallel_task &pool, F condition = {}) noexcept {
+    detail::pso_run(config, pop, vec, f, lb, ub, alg, condition, &pool);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_parallel(std::convertible_to<population<T>> auto &&pop,
+                    std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f,
+                    evolutionary_algorithm &alg, parallel_task &pool,
+                    F condition = {}) noexcept {
+    run_parallel(pop, vec, f, f.lower_bound(), f.upper_bound(), alg, pool,
+                 condition);
+  }
+
   auto update()
 
       noexcept {
@@ -133,4 +170,106 @@ public:
   }
 };
 
+// pso_algorithm over a static_pso_config.
+template <typename Config> class static_pso_algorithm {
+  using T = typename Config::value_type;
+  Config config;
+
+public:
+  using value_type = T;
+
+  static_pso_algorithm(Config &&_config) : config(std::move(_config)) {}
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run(std::convertible_to<population<T>> auto &&pop,
+           std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f, T lb,
+           T ub, evolutionary_algorithm &alg, F condition = {}) noexcept {
+    detail::pso_run(config, pop, vec, f, lb, ub, alg, condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run(std::convertible_to<population<T>> auto &&pop,
+           std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f,
+           evolutionary_algorithm &alg, F condition = {}) noexcept {
+    run(pop, vec, f, f.lower_bound(), f.upper_bound(), alg, condition);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_parallel(std::convertible_to<population<T>> auto &&pop,
+                    std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f,
+                    T lb, T ub, evolutionary_algorithm &alg,
+                    parallel_task &pool, F condition = {}) noexcept {
+    detail::pso_run(config, pop, vec, f, lb, ub, alg, condition, &pool);
+  }
+
+  template <typename F = evolutionary_algorithm_condition>
+  void run_parallel(std::convertible_to<population<T>> auto &&pop,
+                    std::convertible_to<pso_velocity<T>> auto &&vec, auto &&f,
+                    evolutionary_algorithm &alg, parallel_task &pool,
+                    F condition = {}) noexcept {
+    run_parallel(pop, vec, f, f.lower_bound(), f.upper_bound(), alg, pool,
+                 condition);
+  }
+
+  auto &update() noexcept { return config.update; }
+
+  auto &topology() noexcept { return config.topology; }
+
+  auto &constraint_handler() noexcept { return config.constraint_handler; }
+
+  void iterator(auto &&pop, auto &&vec, auto &&f, T lb, T ub,
+                evolutionary_algorithm &alg) noexcept {
+    config.iterator(pop, vec, f, lb, ub, alg);
+  }
+};
+
+// Compile-time counterpart of pso_algorithm_builder. constraint_handler()
+// takes any type with repair_velocity and repair_position, such as
+// static_pso_constraint.
+template <std::floating_point T = float, typename U = detail::no_module,
+          typename Top = detail::no_module,
+          typename C = static_pso_constraint<T>>
+class [[nodiscard]] static_pso_algorithm_builder {
+  static_pso_config<T, U, Top, C> config_;
+
+public:
+  static_pso_algorithm_builder() = default;
+
+  static_pso_algorithm_builder(static_pso_config<T, U, Top, C> &&_config)
+      : config_(std::move(_config)) {}
+
+  template <std::derived_from<pso_update<T>> V> auto update(V &&u) noexcept {
+    using W = std::remove_cvref_t<V>;
+    return static_pso_algorithm_builder<T, W, Top, C>(
+        static_pso_config<T, W, Top, C>{
+            std::forward<V>(u), std::move(config_.topology),
+            std::move(config_.constraint_handler)});
+  }
+
+  template <std::derived_from<pso_topology<T>> V>
+  auto topology(V &&t) noexcept {
+    using W = std::remove_cvref_t<V>;
+    return static_pso_algorithm_builder<T, U, W, C>(
+        static_pso_config<T, U, W, C>{std::move(config_.update),
+                                      std::forward<V>(t),
+                                      std::move(config_.constraint_handler)});
+  }
+
+  template <typename V> auto constraint_handler(V &&c) noexcept {
+    using W = std::remove_cvref_t<V>;
+    return static_pso_algorithm_builder<T, U, Top, W>(
+        static_pso_config<T, U, Top, W>{std::move(config_.update),
+                                        std::move(config_.topology),
+                                        std::forward<V>(c)});
+  }
+
+  auto build() noexcept {
+    static_assert(!std::is_same_v<U, detail::no_module>,
+                  "PSO UPDATE IS MISSING!");
+    static_assert(!std::is_same_v<Top, detail::no_module>,
+                  "PSO TOPOLOGY IS MISSING!");
+    return static_pso_algorithm(std::move(config_));
+  }
+};
+
 } // namespace sevobench::pso_module
@@ -3,23 +3,68 @@
 #include "pso_topology.hpp"
 #include "pso_update.hpp"
 namespace sevobench::pso_module {
+namespace detail {
+using sevobench::detail::module_ref;
+using sevobench::detail::no_module;
+
+template <std::floating_point T>
+inline void pso_iterate(auto &c, auto &&pop, auto &&vec, auto &&f, T lb, T ub,
+                        evolutionary_algorithm &alg,
+                        parallel_task *pool = nullptr) noexcept {
+  auto &update = module_ref(c.update);
+  auto &topology = module_ref(c.topology);
+  for (int i = 0; i < pop.pop_size(); i++) {
+    update.update_velocity(pop, vec, topology, i);
+    c.constraint_handler.repair_velocity(vec[i]);
+    update.update_position(pop, vec, topology, i);
+    c.constraint_handler.repair_position(pop[i], lb, ub);
+  }
+  // Positions are all final before any evaluation, so evaluating the swarm
+  // in parallel does not change the algorithm.
+  if (pool)
+    evaluate_population(pop, f, pop.pop_size(), *pool);
+  else
+    evaluate_population(pop, f, pop.pop_size());
+  alg.add_fes(pop.pop_size());
+  update.update(pop, topology);
+  topology.update(pop);
+  alg.increment_iterator();
+}
+
+inline void pso_serialize(auto &c, checkpoint &ar) noexcept {
+  module_ref(c.update).serialize(ar);
+  module_ref(c.topology).serialize(ar);
+}
+} // namespace detail
+
 template <std::floating_point T> struct pso_config {
   std::unique_ptr<pso_update<T>> update;
   std::unique_ptr<pso_topology<T>> topology;
   pso_constraint<T> constraint_handler;
   void iterator(auto &&pop, auto &&vec, auto &&f, T lb, T ub,
                 evolutionary_algorithm &alg) noexcept {
-    for (int i = 0; i < pop.pop_size(); i++) {
-      update->update_velocity(pop, vec, *topology, i);
-      constraint_handler.repair_velocity(vec[i]);
-      update->update_position(pop, vec, *topology, i);
-      constraint_handler.repair_position(pop[i], lb, ub);
-      pop[i].evaluate(f);
-      alg.increment_fes();
-    }
-    update->update(pop, *topology);
-    topology->update(pop);
-    alg.increment_iterator();
+    detail::pso_iterate(*this, pop, vec, f, lb, ub, alg);
+  }
+
+  void serialize(checkpoint &ar) noexcept { detail::pso_serialize(*this, ar); }
+};
+
+// Compile-time composition: update, topology and constraint handler are held
+// by value with their concrete types.
+template <std::floating_point T, typename U, typename Top,
+          typename C = static_pso_constraint<T>>
+struct static_pso_config {
+  using value_type = T;
+
+  U update;
+  Top topology;
+  C constraint_handler;
+
+  void iterator(auto &&pop, auto &&vec, auto &&f, T lb, T ub,
+                evolutionary_algorithm &alg) noexcept {
+    detail::pso_iterate(*this, pop, vec, f, lb, ub, alg);
   }
+
+  void serialize(checkpoint &ar) noexcept { detail::pso_serialize(*this, ar); }
 };
 } // namespace sevobench::pso_module
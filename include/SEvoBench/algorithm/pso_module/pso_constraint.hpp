@@ -32,6 +32,18 @@ template <std::floating_point T> struct pso_constraint {
   }
 };
 
+// pso_constraint with both handlers held by value, for static_pso_config.
+template <std::floating_point T, typename VC = velocity_constraint<T>,
+          typename PC = positions_constraint<T>>
+struct static_pso_constraint {
+  VC vc;
+  PC pc;
+  void repair_velocity(particle_velocity<T> &v) { vc.repair_velocity(v); }
+  void repair_position(solution<T> &sol, T lb, T ub) {
+    pc.repair_position(sol, lb, ub);
+  }
+};
+
 template <std::floating_point T>
 class spso_velocity_constraint : public velocity_constraint<T> {
   const T vmin;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../../common/tool.hpp"
 #include "../evolutionary_algorithm.hpp"
@@ -7,6 +8,7 @@
 #include <algorithm>
 #include <concepts>
 #include <numeric>
+#include <span>
 
 namespace sevobench::pso_module {
 template <std::floating_point T> class pso_topology {
@@ -27,6 +29,13 @@ public:
 
   virtual int *informant(int, int *) = 0;
 
+  // Offers a solution from outside the swarm, such as an island migrant, as
+  // a personal best; returns whether it was taken.
+  virtual bool inject(std::span<const T>, T) { return false; }
+
+  // Visits the state carried from one iteration to the next.
+  virtual void serialize(checkpoint &) {}
+
   virtual ~pso_topology() {};
 };
 namespace detail {
@@ -57,6 +66,19 @@ public:
       }
     }
   }
+
+  // Replaces the worst personal best if x is better.
+  bool inject(std::span<const T> x, T fitness) override {
+    auto worst = std::ranges::max_element(
+        pbest, {}, [](const auto &s) { return s.fitness(); });
+    if (!(fitness < worst->fitness()))
+      return false;
+    std::ranges::copy(x, worst->begin());
+    worst->set_fitness(fitness);
+    return true;
+  }
+
+  void serialize(checkpoint &ar) override { ar(pbest); }
 };
 } // namespace detail
 
@@ -93,6 +115,17 @@ public:
         this->pbest.begin());
   }
 
+  bool inject(std::span<const T> x, T fitness) override {
+    if (!detail::pbest_base<T>::inject(x, fitness))
+      return false;
+    min_index = static_cast<int>(
+        std::min_element(
+            this->pbest.begin(), this->pbest.end(),
+            [](auto &l, auto &r) { return l.fitness() < r.fitness(); }) -
+        this->pbest.begin());
+    return true;
+  }
+
   int *neighbor(int, int *o) override {
     std::iota(o, o + this->pbest.pop_size(), int(0));
     return o + this->pbest.pop_size();
@@ -104,6 +137,11 @@ public:
       *o++ = min_index;
     return o;
   }
+
+  void serialize(checkpoint &ar) override {
+    detail::pbest_base<T>::serialize(ar);
+    ar(min_index);
+  }
 };
 namespace detail {
 template <int _K, std::floating_point T>
@@ -140,6 +178,11 @@ public:
     }
     return o;
   }
+
+  void serialize(checkpoint &ar) override {
+    pbest_base<T>::serialize(ar);
+    ar(topology_index);
+  }
 };
 } // namespace detail
 template <std::floating_point T>
@@ -201,6 +244,11 @@ public:
       }
     }
   }
+
+  void serialize(checkpoint &ar) override {
+    detail::kneighbor_topology<K, T>::serialize(ar);
+    ar(n, RNG);
+  }
 };
 
 template <std::floating_point T, typename R = sevobench::tool::rng>
@@ -325,6 +373,11 @@ public:
     }
     return o;
   }
+
+  void serialize(checkpoint &ar) override {
+    detail::pbest_base<T>::serialize(ar);
+    ar(topology_index, current_iterator, current_size, RNG);
+  }
 };
 
 template <std::floating_point T, typename R = sevobench::tool::rng>
@@ -373,6 +426,11 @@ public:
     if (++current_iter % regroup_interval == 0)
       regroup_subswarms();
   }
+
+  void serialize(checkpoint &ar) override {
+    detail::kneighbor_topology<K, T>::serialize(ar);
+    ar(indices, current_iter, RNG);
+  }
 };
 
 } // namespace sevobench::pso_module
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../algorithm/evolutionary_algorithm.hpp"
+#include "../../common/checkpoint.hpp"
 #include "../../common/population.hpp"
 #include "../../common/tool.hpp"
 #include "pso_topology.hpp"
@@ -21,6 +22,9 @@ public:
 
   virtual void update(const population<T> &, pso_topology<T> &) {}
 
+  // Visits the state carried from one iteration to the next.
+  virtual void serialize(checkpoint &) {}
+
   virtual ~pso_update() = default;
 };
 
@@ -34,10 +38,15 @@ class decrease_inertia_weight_update final : public pso_update<T> {
   const T c1 = T(2);
   const T c2 = T(2);
 
+  std::vector<T> r1;
+  std::vector<T> r2;
+
 public:
   R RNG1;
   R RNG2;
 
+  void serialize(checkpoint &ar) override { ar(RNG1, RNG2); }
+
   decrease_inertia_weight_update(const evolutionary_algorithm &_alg,
                                  T _w_min = T(0.4), T _w_max = T(0.9),
                                  T _c1 = T(2), T _c2 = T(2))
@@ -50,11 +59,13 @@ public:
     auto &gbest = top.local_best(i);
     auto w =
         w_max + (w_min - w_max) * alg.current_iterator() / alg.max_iterator();
+    r1.resize(dim);
+    r2.resize(dim);
+    tool::fill_uniform(RNG1, std::span<T>(r1));
+    tool::fill_uniform(RNG2, std::span<T>(r2));
     for (int j = 0; j < dim; j++) {
-      vec[i][j] =
-          w * vec[i][j] +
-          c1 * (RNG1.template rand_float<T>()) * (pbest[j] - pop[i][j]) +
-          c2 * (RNG2.template rand_float<T>()) * (gbest[j] - pop[i][j]);
+      vec[i][j] = w * vec[i][j] + c1 * r1[j] * (pbest[j] - pop[i][j]) +
+                  c2 * r2[j] * (gbest[j] - pop[i][j]);
     }
   }
 };
@@ -67,10 +78,15 @@ class inertia_weight_update final : public pso_update<T> {
   const T c1 = T(0.5) + std::numbers::ln2_v<T>;
   const T c2 = T(0.5) + std::numbers::ln2_v<T>;
 
+  std::vector<T> r1;
+  std::vector<T> r2;
+
 public:
   R RNG1;
   R RNG2;
 
+  void serialize(checkpoint &ar) override { ar(RNG1, RNG2); }
+
   inertia_weight_update() = default;
 
   inertia_weight_update(T _w, T _c1, T _c2) : w(_w), c1(_c1), c2(_c2) {}
@@ -80,11 +96,13 @@ public:
     int dim = pop.dim();
     auto &pbest = top.personal_best(i);
     auto &gbest = top.local_best(i);
+    r1.resize(dim);
+    r2.resize(dim);
+    tool::fill_uniform(RNG1, std::span<T>(r1));
+    tool::fill_uniform(RNG2, std::span<T>(r2));
     for (int j = 0; j < dim; j++) {
-      vec[i][j] =
-          w * vec[i][j] +
-          c1 * (RNG1.template rand_float<T>()) * (pbest[j] - pop[i][j]) +
-          c2 * (RNG2.template rand_float<T>()) * (gbest[j] - pop[i][j]);
+      vec[i][j] = w * vec[i][j] + c1 * r1[j] * (pbest[j] - pop[i][j]) +
+                  c2 * r2[j] * (gbest[j] - pop[i][j]);
     }
   }
 };
@@ -96,6 +114,8 @@ class bare_bone_update final : public pso_update<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   void update_position(population<T> &pop, const pso_velocity<T> &,
                        pso_topology<T> &top, int i) override {
     int dim = pop.dim();
@@ -119,6 +139,8 @@ class fips_update : public pso_update<T> {
 public:
   R RNG;
 
+  void serialize(checkpoint &ar) override { ar(RNG); }
+
   fips_update() = default;
 
   fips_update(T _phi)
@@ -159,6 +181,8 @@ public:
   R RNG3;
   R RNG4;
 
+  void serialize(checkpoint &ar) override { ar(RNG1, RNG2, RNG3, RNG4); }
+
   spherical_update() = default;
 
   spherical_update(T _w, T _c1, T _c2) : w(_w), c1(_c1), c2(_c2) {}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sevobench {
+// Binary snapshot of a run. A class visits its state once, in a fixed order,
+// with serialize(checkpoint &ar) { ar(a, b, c); }, and the same call saves or
+// restores it depending on ar.loading(), so the two cannot drift apart.
+//
+// File layout: magic, version, payload size, FNV-1a hash of the payload,
+// payload. Values are stored in native byte order.
+class checkpoint {
+  static constexpr std::uint64_t magic = 0x54504b434f564553; // "SEVOCKPT"
+  static constexpr std::uint64_t version = 1;
+
+  std::vector<char> buf;
+  std::size_t pos = 0;
+  bool loading_ = false;
+  bool good_ = true;
+
+  static auto hash(const char *p, std::size_t n) noexcept {
+    std::uint64_t h = 0xcbf29ce484222325;
+    for (std::size_t i = 0; i < n; i++)
+      h = (h ^ static_cast<unsigned char>(p[i])) * 0x100000001b3;
+    return h;
+  }
+
+  void bytes(void *p, std::size_t n) noexcept {
+    if (!loading_) {
+      auto *c = static_cast<const char *>(p);
+      buf.insert(buf.end(), c, c + n);
+    } else if (good_ && n <= buf.size() - pos) {
+      std::memcpy(p, buf.data() + pos, n);
+      pos += n;
+    } else {
+      good_ = false;
+    }
+  }
+
+  // Element count of a range; a count that cannot fit in the rest of the
+  // payload marks the checkpoint as bad instead of being allocated.
+  std::size_t count(std::size_t n, std::size_t min_bytes) noexcept {
+    std::uint64_t c = n;
+    bytes(&c, sizeof c);
+    if (loading_ && good_ && c * min_bytes > buf.size() - pos) {
+      good_ = false;
+      return 0;
+    }
+    return good_ ? static_cast<std::size_t>(c) : 0;
+  }
+
+  template <typename V> void field(V &v) noexcept {
+    if constexpr (requires { v.serialize(*this); }) {
+      v.serialize(*this);
+    } else if constexpr (requires {
+                         v.first;
+                         v.second;
+                       }) {
+      field(v.first);
+      field(v.second);
+    } else if constexpr (std::ranges::range<V> &&
+                         requires { v.resize(std::size_t()); }) {
+      using E = std::ranges::range_value_t<V>;
+      constexpr bool raw =
+          std::ranges::contiguous_range<V> && std::is_trivially_copyable_v<E>;
+      const auto n = count(v.size(), raw ? sizeof(E) : 1);
+      if (loading_)
+        v.resize(n);
+      if constexpr (raw)
+        bytes(std::ranges::data(v), n * sizeof(E));
+      else
+        for (auto &_ : v)
+          field(_);
+    } else if constexpr (std::is_trivially_copyable_v<V>) {
+      bytes(&v, sizeof v);
+    }
+    // Anything else (e.g. a user generator without serialize()) keeps its
+    // current state.
+  }
+
+  // Turns a snapshot just taken into one to restore from.
+  void rewind() noexcept {
+    loading_ = true;
+    good_ = true;
+    pos = 0;
+  }
+  friend class checkpoint_scope;
+
+public:
+  checkpoint() = default;
+
+  auto loading() const noexcept { return loading_; }
+  auto good() const noexcept { return good_; }
+  // Bytes of a loaded checkpoint not read yet.
+  auto remaining() const noexcept { return buf.size() - pos; }
+
+  template <typename... Args> checkpoint &operator()(Args &...args) noexcept {
+    (field(args), ...);
+    return *this;
+  }
+
+  // Writes to path + ".tmp" and renames it over path, so a job killed while
+  // saving leaves the previous checkpoint intact.
+  bool save(const std::string &path) const noexcept {
+    const auto tmp = path + ".tmp";
+    auto *file = std::fopen(tmp.c_str(), "wb");
+    if (!file)
+      return false;
+    const std::uint64_t header[4] = {magic, version, buf.size(),
+                                     hash(buf.data(), buf.size())};
+    bool ok = std::fwrite(header, sizeof header, 1, file) == 1 &&
+              std::fwrite(buf.data(), 1, buf.size(), file) == buf.size();
+    ok = std::fclose(file) == 0 && ok;
+    return ok && std::rename(tmp.c_str(), path.c_str()) == 0;
+  }
+
+  // A checkpoint ready to restore from, or one with good() == false if path
+  // does not exist or does not hold an intact checkpoint.
+  static checkpoint load(const std::string &path) noexcept {
+    checkpoint ar;
+    ar.loading_ = true;
+    ar.good_ = false;
+    auto *file = std::fopen(path.c_str(), "rb");
+    if (!file)
+      return ar;
+    std::uint64_t header[4];
+    if (std::fread(header, sizeof header, 1, file) == 1 &&
+        header[0] == magic && header[1] == version) {
+      ar.buf.resize(header[2]);
+      ar.good_ =
+          std::fread(ar.buf.data(), 1, ar.buf.size(), file) == ar.buf.size() &&
+          hash(ar.buf.data(), ar.buf.size()) == header[3];
+    }
+    std::fclose(file);
+    return ar;
+  }
+};
+
+// Makes the module algorithms' runs started on this thread resumable: run()
+// restores the snapshot at path if there is one, saves a new one every
+// interval iterations and a last one when it stops. extra visits state kept
+// outside the algorithm, such as the evaluation counter of the problem.
+// evo_bench opens one per run when bench_config::checkpoint_dir is set.
+class checkpoint_scope {
+  struct context {
+    std::string path;
+    int interval = 0;
+    std::function<void(checkpoint &)> extra;
+    bool active = false;
+  };
+  static auto &current() noexcept {
+    thread_local context c;
+    return c;
+  }
+  context saved;
+
+  static void visit(checkpoint &ar, auto &...state) noexcept {
+    auto &c = current();
+    if (c.extra)
+      c.extra(ar);
+    ar(state...);
+  }
+
+public:
+  checkpoint_scope(std::string path, int interval,
+                   std::function<void(checkpoint &)> extra = {}) noexcept
+      : saved(std::move(current())) {
+    current() = {std::move(path), interval, std::move(extra), true};
+  }
+  checkpoint_scope(const checkpoint_scope &) = delete;
+  checkpoint_scope &operator=(const checkpoint_scope &) = delete;
+  ~checkpoint_scope() { current() = std::move(saved); }
+
+  // Whether state was restored. A checkpoint is only valid for the same
+  // algorithm configuration it was saved from; one that does not decode in
+  // full, e.g. because it was saved from another configuration, leaves state
+  // as it was, which is snapshotted first and put back.
+  static bool restore(auto &...state) noexcept {
+    if (!current().active)
+      return false;
+    auto ar = checkpoint::load(current().path);
+    if (!ar.good())
+      return false;
+    checkpoint before;
+    visit(before, state...);
+    visit(ar, state...);
+    if (ar.good() && ar.remaining() == 0)
+      return true;
+    before.rewind();
+    visit(before, state...);
+    return false;
+  }
+
+  // Called once per iteration; saves when iteration is a multiple of the
+  // interval, or always with iteration < 0.
+  static void save(int iteration, auto &...state) noexcept {
+    auto &c = current();
+    if (!c.active || (iteration >= 0 && (c.interval <= 0 ||
+                                         iteration % c.interval != 0)))
+      return;
+    checkpoint ar;
+    visit(ar, state...);
+    ar.save(c.path);
+  }
+};
+} // namespace sevobench
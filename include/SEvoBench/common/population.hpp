@@ -1,44 +1,139 @@
 #pragma once
+#include "../utility/parallel_task.hpp"
 #include "tool.hpp"
 #include <algorithm>
 #include <concepts>
+#include <memory>
+#include <mutex>
 #include <vector>
 namespace sevobench {
 
+namespace detail {
+template <std::floating_point T>
+inline T invoke_objective(auto &&f, auto &x, auto *ptr,
+                          std::size_t n) noexcept {
+  constexpr auto b1 = requires {
+    { f(x) } -> std::same_as<T>;
+  };
+  constexpr auto b2 = requires {
+    { f(ptr) } -> std::same_as<T>;
+  };
+  constexpr auto b3 = requires {
+    { f(ptr, n) } -> std::same_as<T>;
+  };
+  if constexpr (b1) {
+    return f(x);
+  } else if constexpr (b2) {
+    return f(ptr);
+  } else if constexpr (b3) {
+    return f(ptr, n);
+  } else {
+    static_assert(b1 || b2 || b3, "TYPE OF f IS INVALID");
+  }
+}
+} // namespace detail
+
+namespace detail {
+// One cache-line aligned buffer cut into rows of padded_size(dim) values,
+// which hold the positions of a population. A freed row is handed out again.
+template <typename T> class row_arena {
+  const std::size_t stride_;
+  tool::aligned_vector<T> buf;
+  std::vector<T *> free_rows;
+  std::mutex mut;
+
+public:
+  row_arena(int rows, int dim)
+      : stride_(tool::padded_size<T>(dim)), buf(rows * stride_) {
+    free_rows.reserve(rows);
+    for (int i = rows; i-- > 0;)
+      free_rows.push_back(buf.data() + i * stride_);
+  }
+  auto stride() const noexcept { return stride_; }
+  auto contains(const T *p) const noexcept {
+    return p >= buf.data() && p < buf.data() + buf.size();
+  }
+  T *allocate(std::size_t n) noexcept {
+    std::scoped_lock lock(mut);
+    if (n > stride_ || free_rows.empty())
+      return nullptr;
+    auto *p = free_rows.back();
+    free_rows.pop_back();
+    return p;
+  }
+  bool deallocate(T *p) noexcept {
+    if (!contains(p))
+      return false;
+    std::scoped_lock lock(mut);
+    free_rows.push_back(p);
+    return true;
+  }
+};
+
+// Takes a solution's storage from its population's arena, or from the heap
+// for a copy, a solution that grew past its row, or one made on its own.
+// Assigning between solutions copies into the row the target already has,
+// so a population keeps its layout.
+template <typename T> struct row_allocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::false_type;
+  using propagate_on_container_move_assignment = std::false_type;
+  using propagate_on_container_swap = std::true_type;
+  std::shared_ptr<row_arena<T>> arena;
+
+  row_allocator() = default;
+  explicit row_allocator(std::shared_ptr<row_arena<T>> a) noexcept
+      : arena(std::move(a)) {}
+  // Copied even when moved: a moved-from allocator must still free what it
+  // allocated.
+  row_allocator(const row_allocator &) = default;
+  row_allocator &operator=(const row_allocator &) = default;
+  template <typename U>
+  row_allocator(const row_allocator<U> &) noexcept {}
+  T *allocate(std::size_t n) {
+    if (arena)
+      if (auto *p = arena->allocate(n))
+        return p;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T *p, std::size_t n) noexcept {
+    if (!arena || !arena->deallocate(p))
+      std::allocator<T>{}.deallocate(p, n);
+  }
+  row_allocator select_on_container_copy_construction() const noexcept {
+    return {};
+  }
+  bool operator==(const row_allocator &o) const noexcept {
+    return arena == o.arena;
+  }
+};
+} // namespace detail
+
 template <std::floating_point T = float>
-class solution : public std::vector<T> {
+class solution : public std::vector<T, detail::row_allocator<T>> {
+  using base = std::vector<T, detail::row_allocator<T>>;
   T _fitness = std::numeric_limits<T>::max();
 
 public:
-  using std::vector<T>::vector;
+  using base::base;
   auto fitness() const noexcept { return _fitness; }
   auto set_fitness(T f) noexcept { _fitness = f; }
   auto dim() const noexcept { return static_cast<int>(this->size()); }
+  void serialize(auto &ar) noexcept {
+    ar(static_cast<base &>(*this), _fitness);
+  }
+  // Solutions of two populations trade values rather than storage, so that
+  // both keep their rows.
+  friend void swap(solution &a, solution &b) noexcept {
+    if (a.get_allocator() == b.get_allocator() || a.size() != b.size())
+      static_cast<base &>(a).swap(b);
+    else
+      std::swap_ranges(a.begin(), a.end(), b.begin());
+    std::swap(a._fitness, b._fitness);
+  }
   auto evaluate(auto &&f) noexcept {
-    constexpr auto b1 = requires {
-      { f(*this) } -> std::same_as<T>;
-    };
-    constexpr auto b2 = requires {
-      { f(this->data()) } -> std::same_as<T>;
-    };
-    constexpr auto b3 = requires {
-      { f(this->data(), this->size()) } -> std::same_as<T>;
-    };
-    if constexpr (requires {
-                    { f(*this) } -> std::same_as<T>;
-                  }) {
-      _fitness = f(*this);
-    } else if constexpr (requires {
-                           { f(this->data()) } -> std::same_as<T>;
-                         }) {
-      _fitness = f(this->data());
-    } else if constexpr (requires {
-                           { f(this->data(), this->size()) } -> std::same_as<T>;
-                         }) {
-      _fitness = f(this->data(), this->size());
-    } else {
-      static_assert(b1 || b2 || b3, "TYPE OF f IS INVALID");
-    }
+    _fitness =
+        detail::invoke_objective<T>(f, *this, this->data(), this->size());
     return _fitness;
   }
   template <typename R = tool::rng>
@@ -49,6 +144,8 @@ public:
   }
 };
 
+// The positions of population(size, dim) are the rows of one aligned buffer,
+// in order; a copy gets a buffer of its own.
 template <std::floating_point T = float>
 class population : public std::vector<solution<T>> {
   int _dim = 0;
@@ -63,8 +160,27 @@ public:
   }
   population() = default;
   population(int dim_) : _dim(dim_) {}
-  population(int _pop_size, int dim_)
-      : std::vector<solution<T>>(_pop_size, solution<T>(dim_)), _dim(dim_) {}
+  population(int _pop_size, int dim_) : _dim(dim_) {
+    detail::row_allocator<T> rows(
+        std::make_shared<detail::row_arena<T>>(_pop_size, dim_));
+    this->reserve(_pop_size);
+    for (int i = 0; i < _pop_size; i++)
+      this->emplace_back(dim_, T(0), rows);
+  }
+  population(const population &o) : population(o.pop_size(), o.dim()) {
+    std::ranges::copy(o, this->begin());
+  }
+  population(population &&) noexcept = default;
+  population &operator=(const population &o) {
+    if (this == &o)
+      return *this;
+    if (pop_size() == o.pop_size() && _dim == o._dim)
+      std::ranges::copy(o, this->begin());
+    else
+      *this = population(o);
+    return *this;
+  }
+  population &operator=(population &&) noexcept = default;
 
   template <typename R = tool::rng>
     requires tool::random_generator_concept<R, T>
@@ -72,7 +188,103 @@ public:
     randomize(lb, ub, RNG);
   }
   auto pop_size() const noexcept { return static_cast<int>(this->size()); }
+  // The distance between the positions of solutions first to last - 1 when
+  // they are consecutive rows of the buffer, each dim values long, else 0.
+  std::size_t row_stride(int first, int last) const noexcept {
+    if (last <= first)
+      return 0;
+    const auto arena = (*this)[first].get_allocator().arena;
+    if (!arena)
+      return 0;
+    const auto stride = arena->stride();
+    const T *p = (*this)[first].data();
+    for (int i = first; i < last; i++, p += stride)
+      if ((*this)[i].data() != p || (*this)[i].dim() != _dim)
+        return 0;
+    return stride;
+  }
   auto set_dim(int dim_) noexcept { _dim = dim_; }
   auto dim() const noexcept { return _dim; }
+  void serialize(auto &ar) noexcept {
+    ar(_dim, static_cast<std::vector<solution<T>> &>(*this));
+    if (ar.loading())
+      *this = population(*this);
+  }
 };
+
+namespace detail {
+template <std::floating_point T>
+inline void evaluate_range(population<T> &pop, auto &&f, int first,
+                           int last) noexcept {
+  constexpr auto b = requires(std::span<const T> X, std::span<T> out) {
+    f.evaluate_batch(X, 1, std::size_t(1), out);
+  };
+  const int n = last - first;
+  if constexpr (b) {
+    if (n <= 0)
+      return;
+    thread_local tool::aligned_vector<T> X;
+    thread_local std::vector<T> out;
+    const int dim = pop[first].dim();
+    out.resize(n);
+    // Rows still in order in the population's buffer are read in place.
+    auto stride = pop.row_stride(first, last);
+    const T *rows = pop[first].data();
+    if (stride == 0) {
+      stride = tool::padded_size<T>(dim);
+      X.resize(n * stride);
+      for (int i = 0; i < n; i++)
+        std::copy_n(pop[first + i].data(), dim, X.data() + i * stride);
+      rows = X.data();
+    }
+    f.evaluate_batch(std::span<const T>(rows, (n - 1) * stride + dim), n,
+                     stride, std::span<T>(out.data(), n));
+    for (int i = 0; i < n; i++)
+      pop[first + i].set_fitness(out[i]);
+  } else {
+    for (int i = first; i < last; i++)
+      pop[i].evaluate(f);
+  }
+}
+} // namespace detail
+
+template <std::floating_point T>
+inline void evaluate_population(population<T> &pop, auto &&f, int n) noexcept {
+  detail::evaluate_range(pop, f, 0, n);
+}
+
+// f for calls from several threads at once: f.locked(mut) when f keeps
+// bookkeeping that needs a lock, as the problems evo_bench passes do, else f
+// itself, which must then be safe to call concurrently.
+inline decltype(auto) concurrent_objective(auto &f, std::mutex &mut) noexcept {
+  if constexpr (requires { f.locked(mut); })
+    return f.locked(mut);
+  else
+    return (f);
+}
+
+// Evaluates the first n solutions in contiguous chunks on pool, the calling
+// thread taking the first chunk. f is called through concurrent_objective,
+// and the caller should not itself be a task of pool.
+template <std::floating_point T>
+inline void evaluate_population(population<T> &pop, auto &&f0, int n,
+                                parallel_task &pool) noexcept {
+  const int chunks = std::min(n, static_cast<int>(pool.size()) + 1);
+  if (chunks <= 1) {
+    detail::evaluate_range(pop, f0, 0, n);
+    return;
+  }
+  std::mutex mut;
+  auto &&f = concurrent_objective(f0, mut);
+  auto bound = [=](int c) { return int(std::int64_t(n) * c / chunks); };
+  std::vector<std::future<void>> v;
+  v.reserve(chunks - 1);
+  for (int c = 1; c < chunks; c++)
+    v.emplace_back(pool.submit([&, first = bound(c), last = bound(c + 1)] {
+      detail::evaluate_range(pop, f, first, last);
+    }));
+  detail::evaluate_range(pop, f, 0, bound(1));
+  for (auto &_ : v)
+    _.get();
+}
 } // namespace sevobench
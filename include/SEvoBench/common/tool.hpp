@@ -8,6 +8,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <new>
 #include <numbers>
 #include <numeric>
 #include <optional>
@@ -44,6 +45,185 @@ public:
   }
   void seed(std::uint32_t _) const noexcept { g_seed = _; }
 };
+template <std::floating_point T>
+inline auto box_muller(T m, T st, T u, T v) noexcept {
+  return st * std::sqrt(T(-2) * std::log(u)) *
+             std::sin(2 * std::numbers::pi_v<T> * v) +
+         m;
+}
+template <std::floating_point T>
+inline auto cauchy_dis(T a, T b, T y) noexcept {
+  return a + b * std::tan((y - T(0.5)) * std::numbers::pi_v<T>);
+}
+
+inline constexpr auto philox4x32(std::array<std::uint32_t, 4> ctr,
+                                  std::array<std::uint32_t, 2> key) noexcept {
+  for (int r = 0; r < 10; r++) {
+    const auto p0 = std::uint64_t(0xD2511F53u) * ctr[0];
+    const auto p1 = std::uint64_t(0xCD9E8D57u) * ctr[2];
+    ctr = {std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0], std::uint32_t(p1),
+           std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1], std::uint32_t(p0)};
+    key[0] += 0x9E3779B9u;
+    key[1] += 0xBB67AE85u;
+  }
+  return ctr;
+}
+
+struct stream_key {
+  std::uint64_t master = 0;
+  std::uint32_t problem = 0;
+  std::uint32_t instance = 0;
+  std::uint32_t run = 0;
+  std::uint32_t component = 0;
+  constexpr auto derive() const noexcept {
+    auto r = philox4x32({problem, instance, run, component},
+                        {std::uint32_t(master), std::uint32_t(master >> 32)});
+    return std::array<std::uint32_t, 2>{r[0], r[1]};
+  }
+};
+
+class philox_rng {
+  mutable std::array<std::uint32_t, 4> ctr{};
+  mutable std::array<std::uint32_t, 4> buf{};
+  mutable std::array<std::uint32_t, 2> key{};
+  mutable int pos = 4;
+
+public:
+  philox_rng();
+  philox_rng(std::uint64_t _)
+      : key{std::uint32_t(_), std::uint32_t(_ >> 32)} {}
+  philox_rng(const stream_key &k) : key(k.derive()) {}
+  std::uint32_t operator()() const noexcept {
+    if (pos == 4) {
+      buf = philox4x32(ctr, key);
+      if (++ctr[0] == 0)
+        ++ctr[1];
+      pos = 0;
+    }
+    return buf[pos++];
+  }
+  template <typename T> T rand_float(T l = T(0), T r = T(1)) const noexcept {
+    constexpr T k =
+        T(1) / (static_cast<T>(std::numeric_limits<std::uint32_t>::max()) + 1);
+    return l + (*this)() * k * (r - l);
+  }
+  int rand_int(int n) const noexcept { return (*this)() % n; }
+  template <typename T> T normal(T m, T st) const noexcept {
+    return box_muller(m, st, T(1) - rand_float<T>(), rand_float<T>());
+  }
+  template <typename T> T cauchy(T a, T b) const noexcept {
+    return cauchy_dis(a, b, rand_float<T>());
+  }
+  void seed(std::uint64_t _) const noexcept {
+    key = {std::uint32_t(_), std::uint32_t(_ >> 32)};
+    ctr = {};
+    pos = 4;
+  }
+};
+
+class seed_scope {
+  struct context {
+    stream_key key;
+    bool active = false;
+  };
+  static auto &current() noexcept {
+    thread_local context c;
+    return c;
+  }
+  context saved;
+
+public:
+  seed_scope(std::uint64_t master, std::uint32_t problem,
+             std::uint32_t instance, std::uint32_t run) noexcept
+      : saved(current()) {
+    current() = {{master, problem, instance, run, 0}, true};
+  }
+  seed_scope(const seed_scope &) = delete;
+  seed_scope &operator=(const seed_scope &) = delete;
+  ~seed_scope() { current() = saved; }
+  static std::optional<stream_key> next() noexcept {
+    auto &c = current();
+    if (!c.active)
+      return std::nullopt;
+    auto k = c.key;
+    c.key.component++;
+    return k;
+  }
+};
+
+inline auto random_seed() noexcept {
+  if (auto k = seed_scope::next())
+    return k->derive()[0];
+  return std::uint32_t(std::random_device{}());
+}
+
+struct seed_source {
+  auto operator()() const noexcept { return random_seed(); }
+};
+
+inline philox_rng::philox_rng() {
+  if (auto k = seed_scope::next()) {
+    key = k->derive();
+  } else {
+    std::random_device rd;
+    key = {rd(), rd()};
+  }
+}
+
+inline constexpr std::size_t cache_line_size = 64;
+
+template <typename T, std::size_t Align = cache_line_size>
+  requires(Align >= alignof(T)) && (Align % alignof(T) == 0)
+struct aligned_allocator {
+  using value_type = T;
+  template <typename U> struct rebind {
+    using other = aligned_allocator<U, Align>;
+  };
+  aligned_allocator() = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t(Align)));
+  }
+  void deallocate(T *p, std::size_t) noexcept {
+    ::operator delete(p, std::align_val_t(Align));
+  }
+  template <typename U>
+  bool operator==(const aligned_allocator<U, Align> &) const noexcept {
+    return true;
+  }
+};
+
+template <typename T, std::size_t Align = cache_line_size>
+using aligned_vector = std::vector<T, aligned_allocator<T, Align>>;
+
+template <typename T>
+inline constexpr int padded_size(int n,
+                                 std::size_t align = cache_line_size) noexcept {
+  const auto k = static_cast<int>(std::max<std::size_t>(align / sizeof(T), 1));
+  return (n + k - 1) / k * k;
+}
+
+template <typename T> class shared_array : public std::span<const T> {
+  std::shared_ptr<const void> owner_;
+
+public:
+  shared_array() = default;
+  shared_array(std::span<const T> s, std::shared_ptr<const void> owner) noexcept
+      : std::span<const T>(s), owner_(std::move(owner)) {}
+  template <typename Alloc> shared_array(std::vector<T, Alloc> &&v) {
+    std::shared_ptr<const aligned_vector<T>> p;
+    if constexpr (std::is_same_v<Alloc, aligned_allocator<T>>)
+      p = std::make_shared<const aligned_vector<T>>(std::move(v));
+    else
+      p = std::make_shared<const aligned_vector<T>>(v.begin(), v.end());
+    static_cast<std::span<const T> &>(*this) = std::span<const T>(*p);
+    owner_ = std::move(p);
+  }
+  const auto &owner() const noexcept { return owner_; }
+};
+
 template <int N, std::floating_point T> inline constexpr T Pow(T x) noexcept {
   if constexpr (N <= 0)
     return T(1);
@@ -74,7 +254,7 @@ inline auto binary_find_iteration(F &&f, int fes1, int fes2) noexcept {
 template <int N, std::floating_point T, typename V>
 [[deprecated]] inline auto orthogonal_basis(V &b) noexcept {
 
-  std::random_device rd;
+  seed_source rd;
   std::normal_distribution<T> norm(T(0), T(1));
   std::default_random_engine gen(rd()); // TODO: seed ?
   T sp(0);
@@ -99,10 +279,9 @@ template <int N, std::floating_point T, typename V>
   }
 }
 
-template <int N, std::floating_point T>
-  requires(N > 0)
-inline auto generate_rotate_vector(std::span<T> b) noexcept {
-  std::random_device rd;
+template <std::floating_point T>
+inline auto generate_rotate_vector(std::span<T> b, int N) noexcept {
+  seed_source rd;
   std::normal_distribution<T> norm(T(0), T(1));
   std::default_random_engine gen(rd()); // TODO: seed ?
   T sp(0);
@@ -127,11 +306,17 @@ inline auto generate_rotate_vector(std::span<T> b) noexcept {
   return b;
 }
 
+template <int N, std::floating_point T>
+  requires(N > 0)
+inline auto generate_rotate_vector(std::span<T> b) noexcept {
+  return generate_rotate_vector<T>(b, N);
+}
+
 template <int N, std::floating_point T>
   requires(N > 0)
 [[deprecated]] inline auto generate_shift(T lb, T ub) noexcept {
   std::vector<T> m;
-  std::random_device rd;
+  seed_source rd;
   std::default_random_engine gen(rd());
   std::uniform_real_distribution<T> o1(lb, ub);
   std::generate_n(m.begin(), N, [&] { return o1(gen); });
@@ -178,17 +363,6 @@ inline void kunth_shuffle(RandomIt first, RandomIt last,
     std::swap(first[i], first[sr() % (i + 1)]);
 }
 
-template <std::floating_point T>
-inline auto box_muller(T m, T st, T u, T v) noexcept {
-  return st * std::sqrt(T(-2) * std::log(u)) *
-             std::sin(2 * std::numbers::pi_v<T> * v) +
-         m;
-}
-template <std::floating_point T>
-inline auto cauchy_dis(T a, T b, T y) noexcept {
-  return a + b * std::tan((y - T(0.5)) * std::numbers::pi_v<T>);
-}
-
 template <std::floating_point T, int Max>
 class curve_vector : public std::vector<T> {
 public:
@@ -201,7 +375,7 @@ using curve_t = std::conditional_t<b, curve_vector<T, Max>, void *>;
 template <std::floating_point T, int Dim, int Pop_Size>
 inline auto random_generate_position(T l, T r) noexcept {
   std::vector<std::array<T, Dim>> positions(Pop_Size);
-  std::random_device rd;
+  seed_source rd;
   std::default_random_engine gen(rd());
   std::uniform_real_distribution<T> dis(l, r);
   std::for_each_n(positions.begin(), Pop_Size, [&](auto &x) {
@@ -228,15 +402,61 @@ concept random_generator_concept = requires(R r) {
 };
 
 class rng {
+  static constexpr int lanes = 8;
   xorshift32_rand sr;
+  mutable std::array<std::uint32_t, lanes> state{};
+
+  void seed_lanes(std::uint32_t _) const noexcept {
+    for (int k = 0; k < lanes; k += 4) {
+      auto b = philox4x32({std::uint32_t(k), 0, 0, 0}, {_, 0x5EED1A5Eu});
+      for (int j = 0; j < 4; j++)
+        state[k + j] = b[j] != 0 ? b[j] : 0x9E3779B9u;
+    }
+  }
+
+  auto next_lanes() const noexcept {
+    std::array<std::uint32_t, lanes> b;
+    for (int k = 0; k < lanes; k++) {
+      auto x = state[k];
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      state[k] = b[k] = x;
+    }
+    return b;
+  }
+
+  template <typename T> static constexpr int dropped_bits() noexcept {
+    return std::max(32 - std::numeric_limits<T>::digits, 0);
+  }
+
+  // u in [0, 1)
+  template <typename T> static T to_unit(std::uint32_t x) noexcept {
+    constexpr T k = T(1) / T(std::uint64_t(1) << (32 - dropped_bits<T>()));
+    return T(x >> dropped_bits<T>()) * k;
+  }
+
+  // u in (0, 1)
+  template <typename T> static T to_open_unit(std::uint32_t x) noexcept {
+    constexpr T k = T(1) / T(std::uint64_t(1) << (32 - dropped_bits<T>()));
+    return (T(x >> dropped_bits<T>()) + T(0.5)) * k;
+  }
+
+  template <int Block, typename T>
+  void fill_blocks(std::span<T> out, auto &&gen) const noexcept {
+    const auto n = out.size();
+    std::size_t i = 0;
+    for (; i + Block <= n; i += Block)
+      gen(out.data() + i);
+    if (i < n) {
+      std::array<T, Block> tail;
+      gen(tail.data());
+      std::copy_n(tail.begin(), n - i, out.begin() + i);
+    }
+  }
 
 public:
-  rng(std::uint32_t _ =
-          [] {
-            std::random_device rd;
-            return rd();
-          }())
-      : sr(_) {};
+  rng(std::uint32_t _ = random_seed()) : sr(_) { seed_lanes(_); };
   template <typename T> T rand_float(T l = T(0), T r = T(1)) const noexcept {
     constexpr T k =
         T(1) / (static_cast<T>(std::numeric_limits<std::uint32_t>::max()) + 1);
@@ -253,7 +473,43 @@ public:
   template <typename T> T cauchy(T a, T b) const noexcept {
     return cauchy_dis(a, b, rand_float<T>());
   }
-  void seed(unsigned int _) const noexcept { sr.seed(_); }
+  void seed(unsigned int _) const noexcept {
+    sr.seed(_);
+    seed_lanes(_);
+  }
+
+  // Bulk draws run independent xorshift lanes, so the loops vectorize.
+  template <std::floating_point T>
+  void fill_uniform(std::span<T> out, T l = T(0), T r = T(1)) const noexcept {
+    fill_blocks<lanes>(out, [&](T *y) {
+      auto b = next_lanes();
+      for (int k = 0; k < lanes; k++)
+        y[k] = l + to_unit<T>(b[k]) * (r - l);
+    });
+  }
+
+  template <std::floating_point T>
+  void fill_normal(std::span<T> out, T m = T(0), T st = T(1)) const noexcept {
+    fill_blocks<2 * lanes>(out, [&](T *y) {
+      auto u = next_lanes();
+      auto v = next_lanes();
+      for (int k = 0; k < lanes; k++) {
+        auto rad = st * std::sqrt(T(-2) * std::log(to_open_unit<T>(u[k])));
+        auto theta = 2 * std::numbers::pi_v<T> * to_unit<T>(v[k]);
+        y[k] = m + rad * std::cos(theta);
+        y[k + lanes] = m + rad * std::sin(theta);
+      }
+    });
+  }
+
+  template <std::floating_point T>
+  void fill_cauchy(std::span<T> out, T a = T(0), T b = T(1)) const noexcept {
+    fill_blocks<lanes>(out, [&](T *y) {
+      auto u = next_lanes();
+      for (int k = 0; k < lanes; k++)
+        y[k] = cauchy_dis(a, b, to_open_unit<T>(u[k]));
+    });
+  }
 
   template <int K> auto pick_random(int n, int j) const noexcept {
     std::array<int, K> select{};
@@ -268,4 +524,35 @@ public:
   }
 };
 
+// Generators without a bulk interface fall back to scalar draws.
+template <std::floating_point T, typename R>
+inline void fill_uniform(const R &r, std::span<T> out, T l = T(0),
+                         T u = T(1)) noexcept {
+  if constexpr (requires { r.fill_uniform(out, l, u); })
+    r.fill_uniform(out, l, u);
+  else
+    for (auto &x : out)
+      x = r.template rand_float<T>(l, u);
+}
+
+template <std::floating_point T, typename R>
+inline void fill_normal(const R &r, std::span<T> out, T m = T(0),
+                        T st = T(1)) noexcept {
+  if constexpr (requires { r.fill_normal(out, m, st); })
+    r.fill_normal(out, m, st);
+  else
+    for (auto &x : out)
+      x = r.normal(m, st);
+}
+
+template <std::floating_point T, typename R>
+inline void fill_cauchy(const R &r, std::span<T> out, T a = T(0),
+                        T b = T(1)) noexcept {
+  if constexpr (requires { r.fill_cauchy(out, a, b); })
+    r.fill_cauchy(out, a, b);
+  else
+    for (auto &x : out)
+      x = r.cauchy(a, b);
+}
+
 } // namespace sevobench::tool
@@ -16,7 +16,27 @@ private:
   const int step_;
   const int runs_;
 
+  auto slot(int problem_index, int instance) const noexcept {
+    auto m = std::find(pro_index.begin(), pro_index.end(), problem_index) -
+             pro_index.begin();
+    return static_cast<std::size_t>(m * ins_count_ + instance - 1);
+  }
+
 public:
+  struct alignas(tool::cache_line_size) run_type {
+    std::size_t group = 0;
+    int run_id = 0;
+    int max_fes = 0;
+    int step = 1;
+    T best = std::numeric_limits<T>::max();
+    data_type trace{};
+    void log(const problem::problem_state<T> &state) noexcept {
+      best = std::min(best, state.current_value);
+      if (state.evaluations % step == 0 && state.evaluations <= max_fes)
+        trace.emplace_back(state.evaluations, best);
+    }
+    void serialize(auto &ar) noexcept { ar(best, trace); }
+  };
   best_so_far_record(const auto &_suite, int _max_fes, int _runs, int _step)
       : bests(_runs * _suite.size(), std::numeric_limits<T>::max()),
         pro_index(_suite.problem_index()), ins_count_(_suite.instance_count()),
@@ -44,6 +64,18 @@ public:
       }
     }
   }
+  auto open_run(const problem::problem_info<T> &info, int run_id) const {
+    run_type r{.group = slot(info.index, info.instance),
+               .run_id = run_id,
+               .max_fes = max_fes_,
+               .step = step_};
+    r.trace.reserve(max_fes_ / step_);
+    return r;
+  }
+  void close_run(run_type &r) noexcept {
+    bests[r.group * runs_ + r.run_id - 1] = r.best;
+    data_[r.group][r.run_id - 1] = std::move(r.trace);
+  }
   auto at(int problem_index) const noexcept {
     auto m = std::find(pro_index.begin(), pro_index.end(), problem_index) -
              pro_index.begin();
@@ -56,5 +88,8 @@ public:
     return std::span<const data_type>(data_[m * ins_count_ + instance - 1]);
   }
   auto best() const noexcept { return std::span<const T>(bests); }
+  const auto &problem_index() const noexcept { return pro_index; }
+  auto instance_count() const noexcept { return ins_count_; }
+  auto runs() const noexcept { return runs_; }
 };
 } // namespace sevobench::experiment
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace sevobench::experiment {
+// Bounded memo of evaluations keyed by the exact bits of x, so that -0 and
+// 0, or two NaNs with different payloads, are different keys. The table is
+// direct-mapped: a new entry replaces whatever shared its slot.
+//
+// Lookups and inserts never block. Each slot is guarded by a sequence
+// number that is odd while the slot is written; a reader that sees it
+// change discards what it read, and a writer that finds the slot taken
+// drops its entry.
+template <std::floating_point T> class eval_cache {
+  using word = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+  // x87 long double keeps 6 bytes of padding that must not reach the key.
+  static constexpr std::size_t value_bytes =
+      std::numeric_limits<T>::digits == 64 ? 10 : sizeof(T);
+  static constexpr std::size_t words =
+      (sizeof(T) + sizeof(word) - 1) / sizeof(word);
+  static_assert(std::atomic<word>::is_always_lock_free);
+
+  struct slot {
+    std::atomic<std::uint64_t> seq{0};
+    std::atomic<std::uint64_t> hash{0};
+  };
+
+  const std::size_t dim_;
+  const std::size_t mask;
+  const std::size_t stride;
+  std::unique_ptr<slot[]> slots;
+  std::unique_ptr<std::atomic<word>[]> data;
+  std::atomic<long> hits_{0};
+
+  static auto split(T v) noexcept {
+    std::array<word, words> w{};
+    std::memcpy(w.data(), &v, value_bytes);
+    return w;
+  }
+
+public:
+  // capacity is rounded up to a power of two.
+  eval_cache(int capacity, int dim) noexcept
+      : dim_(static_cast<std::size_t>(dim)),
+        mask(std::bit_ceil(static_cast<std::size_t>(std::max(capacity, 1))) -
+             1),
+        stride((dim_ + 1) * words), slots(std::make_unique<slot[]>(mask + 1)),
+        data(std::make_unique<std::atomic<word>[]>((mask + 1) * stride)) {}
+  eval_cache(const eval_cache &) = delete;
+  eval_cache &operator=(const eval_cache &) = delete;
+
+  auto capacity() const noexcept { return mask + 1; }
+  auto hits() const noexcept { return hits_.load(std::memory_order_relaxed); }
+
+  std::uint64_t key(std::span<const T> x) const noexcept {
+    std::uint64_t h = 0x9e3779b97f4a7c15;
+    for (auto v : x)
+      for (auto w : split(v))
+        h = (std::rotl(h, 5) ^ w) * 0x9e3779b97f4a7c15;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    return h ^ (h >> 33);
+  }
+
+  // The cached value of x, whose key is h.
+  std::optional<T> find(std::span<const T> x, std::uint64_t h) noexcept {
+    auto &s = slots[h & mask];
+    const auto seq = s.seq.load(std::memory_order_acquire);
+    if (x.size() != dim_ || seq == 0 || (seq & 1) ||
+        s.hash.load(std::memory_order_relaxed) != h)
+      return std::nullopt;
+    const auto *d = data.get() + (h & mask) * stride;
+    for (auto v : x)
+      for (auto w : split(v))
+        if (d++->load(std::memory_order_relaxed) != w)
+          return std::nullopt;
+    std::array<word, words> w;
+    for (auto &_ : w)
+      _ = d++->load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (s.seq.load(std::memory_order_relaxed) != seq)
+      return std::nullopt;
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    T value{};
+    std::memcpy(&value, w.data(), value_bytes);
+    return value;
+  }
+
+  void insert(std::span<const T> x, std::uint64_t h, T value) noexcept {
+    auto &s = slots[h & mask];
+    auto seq = s.seq.load(std::memory_order_relaxed);
+    if (x.size() != dim_ || (seq & 1) ||
+        !s.seq.compare_exchange_strong(seq, seq + 1,
+                                       std::memory_order_relaxed))
+      return;
+    std::atomic_thread_fence(std::memory_order_release);
+    s.hash.store(h, std::memory_order_relaxed);
+    auto *d = data.get() + (h & mask) * stride;
+    for (auto v : x)
+      for (auto w : split(v))
+        d++->store(w, std::memory_order_relaxed);
+    for (auto w : split(value))
+      d++->store(w, std::memory_order_relaxed);
+    s.seq.store(seq + 2, std::memory_order_release);
+  }
+};
+} // namespace sevobench::experiment
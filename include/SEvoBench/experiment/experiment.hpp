@@ -1,7 +1,11 @@
 #pragma once
 
+#include "../common/checkpoint.hpp"
 #include "../problem/suite.hpp"
 #include "../utility/parallel_task.hpp"
+#include "eval_cache.hpp"
+#include <mutex>
+#include <variant>
 
 namespace sevobench::experiment {
 
@@ -12,39 +16,198 @@ template <std::floating_point T> struct suite_observer {
 };
 
 namespace detail {
+template <typename S, typename T>
+concept run_observer =
+    requires(S &o, typename S::run_type &r,
+             const problem::problem_info<T> &info,
+             const problem::problem_state<T> &state) {
+      { o.open_run(info, 1) } -> std::same_as<typename S::run_type>;
+      r.log(state);
+      o.close_run(r);
+    };
+
+template <typename S, typename T> struct run_type_of {
+  using type = std::monostate;
+};
+template <typename S, typename T>
+  requires run_observer<S, T>
+struct run_type_of<S, T> {
+  using type = typename S::run_type;
+};
+
 template <std::floating_point T, typename S> struct suite_problem {
 private:
+  using run_type = typename run_type_of<S, T>::type;
+  // Shared by all copies, so that an algorithm taking f by value or behind
+  // a std::function still logs into the run.
+  struct run_state {
+    int evals = 0;
+    run_type run;
+  };
   problem::single_problem<T> *p;
   S &o;
-  mutable int _run_id = 0;
-  mutable int evals = 0;
+  int _run_id = 0;
+  std::shared_ptr<run_state> state;
+  mutable eval_cache<T> *cache = nullptr;
+  mutable bool log_hits = true;
+  // Set only in the copies locked() hands to concurrent callers.
+  std::mutex *mut = nullptr;
+
+  auto logged(auto &&fn) const noexcept {
+    if (mut) {
+      std::scoped_lock lock(*mut);
+      fn();
+    } else {
+      fn();
+    }
+  }
+  auto log(T value, std::span<const T> x) const noexcept {
+    problem::problem_state<T> s{.evaluations = ++state->evals,
+                                .run_id = _run_id,
+                                .current_value = value,
+                                .current_x = x};
+    if constexpr (run_observer<S, T>)
+      state->run.log(s);
+    else
+      o.log(s, p->problem_information());
+  }
 
 public:
+  using value_type = T;
+
   suite_problem(problem::single_problem<T> *_p, S &_o, int _run_id)
-      : p(_p), o(_o), _run_id(_run_id) {}
+      : p(_p), o(_o), _run_id(_run_id), state(std::make_shared<run_state>()) {
+    if constexpr (run_observer<S, T>)
+      state->run = o.open_run(p->problem_information(), _run_id);
+  }
+  // Answers repeated evaluations from c. A hit is logged, and so counts
+  // toward FES, only with count_hits.
+  void use_cache(eval_cache<T> *c, bool count_hits) const noexcept {
+    cache = c;
+    log_hits = count_hits;
+  }
   auto operator()(std::span<const T> x) const noexcept {
+    std::uint64_t h = 0;
+    if (cache) {
+      h = cache->key(x);
+      if (auto hit = cache->find(x, h)) {
+        if (log_hits)
+          logged([&] { log(*hit, x); });
+        return *hit;
+      }
+    }
     auto value = (*p)(x);
-    o.log(problem::problem_state<T>{.evaluations = ++evals,
-                                    .run_id = _run_id,
-                                    .current_value = value,
-                                    .current_x = x},
-          p->problem_information());
+    if (cache)
+      cache->insert(x, h, value);
+    logged([&] { log(value, x); });
     return value;
   }
+  bool evaluate_batch(std::span<const T> X, int n, std::size_t stride,
+                      std::span<T> out) const noexcept {
+    if (!problem::batch_fits(X, n, stride, p->dim(), out))
+      return false;
+    const auto dim = static_cast<std::size_t>(p->dim());
+    auto row = [&](int r) { return X.subspan(r * stride, dim); };
+    if (!cache) {
+      p->evaluate_batch(X, n, stride, out);
+      logged([&] {
+        for (int r = 0; r < n; r++)
+          log(out[r], row(r));
+      });
+      return true;
+    }
+    // Rows not found in the cache are evaluated as one smaller batch.
+    thread_local std::vector<std::uint64_t> keys;
+    thread_local std::vector<int> misses;
+    thread_local tool::aligned_vector<T> mx;
+    thread_local std::vector<T> mout;
+    keys.resize(n);
+    misses.clear();
+    for (int r = 0; r < n; r++) {
+      keys[r] = cache->key(row(r));
+      if (auto hit = cache->find(row(r), keys[r]))
+        out[r] = *hit;
+      else
+        misses.push_back(r);
+    }
+    const auto m = static_cast<int>(misses.size());
+    if (m == n) {
+      p->evaluate_batch(X, n, stride, out);
+    } else if (m > 0) {
+      mx.resize(m * dim);
+      mout.resize(m);
+      for (int i = 0; i < m; i++)
+        std::ranges::copy(row(misses[i]), mx.begin() + i * dim);
+      p->evaluate_batch(std::span<const T>(mx.data(), m * dim), m, dim,
+                        std::span<T>(mout.data(), m));
+      for (int i = 0; i < m; i++)
+        out[misses[i]] = mout[i];
+    }
+    for (auto r : misses)
+      cache->insert(row(r), keys[r], out[r]);
+    logged([&] {
+      for (int r = 0, i = 0; r < n; r++) {
+        const bool miss = i < m && misses[i] == r;
+        i += miss;
+        if (miss || log_hits)
+          log(out[r], row(r));
+      }
+    });
+    return true;
+  }
+  auto finish() const noexcept {
+    if constexpr (run_observer<S, T>)
+      o.close_run(state->run);
+  }
   auto lower_bound() const noexcept { return p->lower_bound(); }
   auto upper_bound() const noexcept { return p->upper_bound(); }
   const auto &problem_information() const noexcept {
     return p->problem_information();
   }
-  auto current_fes() const noexcept { return evals; }
+  // A copy that logs under m, for evaluate_population with a pool and
+  // run_async, which call it from several threads at once.
+  auto locked(std::mutex &m) const noexcept {
+    auto f = *this;
+    f.mut = &m;
+    return f;
+  }
+  auto current_fes() const noexcept { return state->evals; }
   auto run_id() const noexcept { return _run_id; }
+  // Evaluation counter and the observer's per-run state, saved alongside
+  // the algorithm so that a resumed run logs as if it had never stopped.
+  void serialize(checkpoint &ar) const noexcept {
+    ar(state->evals, state->run);
+  }
 };
 
 } // namespace detail
 
+struct bench_config {
+  int independent_runs = 1;
+  std::optional<std::uint64_t> seed;
+  // Every run checkpoints to checkpoint_dir every checkpoint_interval
+  // iterations and when it ends, and resumes from there when restarted.
+  std::optional<std::string> checkpoint_dir;
+  int checkpoint_interval = 100;
+  // Every run memoizes up to cache_size evaluations, keyed by the exact bits
+  // of x; only for deterministic objectives. With cache_counts_fes a hit is
+  // logged as an evaluation, so observers see what they would without the
+  // cache. Without it, hits are not logged and f.current_fes() counts only
+  // the evaluations actually made, but an algorithm still counts every call
+  // toward its own max_fes.
+  int cache_size = 0;
+  bool cache_counts_fes = true;
+};
+
 template <bool parallel = true>
 inline auto evo_bench(auto &&alg, auto &&su, auto &&obs,
-                      int independent_runs) noexcept {
+                      const bench_config &config) noexcept {
+  const auto independent_runs = config.independent_runs;
+  const auto seed = config.seed;
+  const auto checkpoint_dir = config.checkpoint_dir;
+  const auto checkpoint_interval = config.checkpoint_interval;
+  const auto cache_size = config.cache_size;
+  const auto cache_counts_fes = config.cache_counts_fes;
   [[maybe_unused]] std::conditional_t<parallel, parallel_task, void *> pt{};
   [[maybe_unused]] std::conditional_t<parallel, std::vector<std::future<void>>,
                                       void *> v{};
@@ -58,20 +221,35 @@ inline auto evo_bench(auto &&alg, auto &&su, auto &&obs,
     static_assert(b1 || b2, "ALGORITHM IS INVALID!");
     for (int i = 0; i < independent_runs; i++) {
       auto temp_p = detail::suite_problem(p.get(), obs, i + 1);
-      if constexpr (b1) {
-        if constexpr (parallel) {
-          v.emplace_back(pt.submit([=] {
-            alg(temp_p, temp_p.lower_bound(), temp_p.upper_bound());
-          }));
-        } else {
+      auto task = [=, index = p->index(), instance = p->instance(),
+                   dim = p->dim()] {
+        std::optional<tool::seed_scope> scope;
+        if (seed)
+          scope.emplace(*seed, index, instance, i + 1);
+        std::optional<checkpoint_scope> resume;
+        if (checkpoint_dir)
+          resume.emplace(*checkpoint_dir + "/" + std::to_string(index) + "_" +
+                             std::to_string(instance) + "_" +
+                             std::to_string(i + 1) + ".ckpt",
+                         checkpoint_interval,
+                         [&](checkpoint &ar) { temp_p.serialize(ar); });
+        // Allocated here rather than with the task, since evo_bench creates
+        // every run's task up front.
+        using V = typename decltype(temp_p)::value_type;
+        std::optional<eval_cache<V>> cache;
+        if (cache_size > 0)
+          temp_p.use_cache(&cache.emplace(cache_size, dim), cache_counts_fes);
+        if constexpr (b1) {
           alg(temp_p, temp_p.lower_bound(), temp_p.upper_bound());
-        }
-      } else {
-        if constexpr (parallel) {
-          v.emplace_back(pt.submit([=] { alg(temp_p); }));
         } else {
           alg(temp_p);
         }
+        temp_p.finish();
+      };
+      if constexpr (parallel) {
+        v.emplace_back(pt.submit(std::move(task)));
+      } else {
+        task();
       }
     }
   }
@@ -80,4 +258,17 @@ inline auto evo_bench(auto &&alg, auto &&su, auto &&obs,
       _.get();
   }
 }
+
+template <bool parallel = true>
+inline auto evo_bench(auto &&alg, auto &&su, auto &&obs,
+                      int independent_runs) noexcept {
+  evo_bench<parallel>(
+      alg, su, obs,
+      bench_config{.independent_runs = independent_runs,
+                   .seed = std::nullopt,
+                   .checkpoint_dir = std::nullopt,
+                   .checkpoint_interval = 0,
+                   .cache_size = 0,
+                   .cache_counts_fes = true});
+}
 } // namespace sevobench::experiment
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "experiment.hpp"
+#include <climits>
+#include <tuple>
+
+namespace sevobench::experiment {
+// Triggers decide, per evaluation, whether an observer of a pipeline sees
+// it. They hold per-run state and are checked with at most a counter update
+// and a compare.
+namespace trigger {
+struct trigger_base {
+  // Whether the pipeline must track best-so-far for this trigger.
+  static constexpr bool tracks_best = false;
+  // Whether the trigger fires once when the run closes.
+  static constexpr bool at_close = false;
+};
+
+struct always : trigger_base {
+  constexpr bool operator()(int, bool) const noexcept { return true; }
+};
+
+// Every K-th evaluation of a run.
+template <int K> struct every : trigger_base {
+  static_assert(K > 0);
+  int left = K;
+  constexpr bool operator()(int, bool) noexcept {
+    if (--left != 0)
+      return false;
+    left = K;
+    return true;
+  }
+};
+
+// Evaluations that improve on best-so-far.
+struct on_improvement : trigger_base {
+  static constexpr bool tracks_best = true;
+  constexpr bool operator()(int, bool improved) const noexcept {
+    return improved;
+  }
+};
+
+// The evaluations numbered Fes..., which must be ascending.
+template <int... Fes> struct at_fes : trigger_base {
+  static constexpr int fes[] = {Fes..., INT_MAX};
+  static_assert(std::ranges::is_sorted(fes));
+  int next = 0;
+  constexpr bool operator()(int evaluations, bool) noexcept {
+    if (evaluations != fes[next])
+      return false;
+    next++;
+    return true;
+  }
+};
+
+// Once, when the run closes, with the last evaluation count and the
+// best-so-far value of the run.
+struct final_only : trigger_base {
+  static constexpr bool tracks_best = true;
+  static constexpr bool at_close = true;
+  constexpr bool operator()(int, bool) const noexcept { return false; }
+};
+} // namespace trigger
+
+template <typename Trigger, typename Observer> struct pipeline_stage {
+  using trigger_type = Trigger;
+  using observer_type = Observer;
+  Observer *observer;
+};
+
+// A stage of a pipeline: observer sees the evaluations Trigger lets through.
+template <typename Trigger> inline auto when(auto &observer) noexcept {
+  return pipeline_stage<Trigger, std::remove_cvref_t<decltype(observer)>>{
+      &observer};
+}
+
+namespace detail {
+template <std::floating_point T, typename Stage> struct stage_run {
+  using observer_type = typename Stage::observer_type;
+  static constexpr bool by_run = run_observer<observer_type, T>;
+
+  typename Stage::trigger_type trigger{};
+  observer_type *observer = nullptr;
+  const problem::problem_info<T> *info = nullptr;
+  typename run_type_of<observer_type, T>::type run{};
+
+  void emit(const problem::problem_state<T> &state) noexcept {
+    if constexpr (by_run)
+      run.log(state);
+    else
+      observer->log(state, *info);
+  }
+  void open(observer_type *o, const problem::problem_info<T> &i,
+            int run_id) noexcept {
+    observer = o;
+    info = &i;
+    if constexpr (by_run)
+      run = o->open_run(i, run_id);
+  }
+  void log(const problem::problem_state<T> &state, bool improved) noexcept {
+    if (trigger(state.evaluations, improved))
+      emit(state);
+  }
+  void close(const problem::problem_state<T> &last) noexcept {
+    if constexpr (Stage::trigger_type::at_close)
+      emit(last);
+    if constexpr (by_run)
+      observer->close_run(run);
+  }
+  void serialize(checkpoint &ar) noexcept { ar(trigger, run); }
+};
+} // namespace detail
+
+// Run observer that feeds several observers, each behind its own trigger,
+// without virtual calls on the evaluations no trigger lets through:
+//
+//   auto pipeline = make_pipeline<T>(when<trigger::always>(recorder),
+//                                    when<trigger::every<1000>>(monitor));
+//   evo_bench(alg, suite, pipeline, config);
+//
+// Observers with a run_type are opened and closed with the pipeline's runs;
+// others get log(state, info) calls.
+template <std::floating_point T, typename... Stages> class observer_pipeline {
+  std::tuple<Stages...> stages;
+
+  static constexpr bool tracks_best =
+      (Stages::trigger_type::tracks_best || ...);
+  static constexpr bool tracks_last = (Stages::trigger_type::at_close || ...);
+
+public:
+  using value_type = T;
+
+  struct run_type {
+    std::tuple<detail::stage_run<T, Stages>...> runs;
+    int run_id = 0;
+    int last = 0;
+    T best = std::numeric_limits<T>::max();
+
+    void log(const problem::problem_state<T> &state) noexcept {
+      bool improved = false;
+      if constexpr (tracks_best) {
+        improved = state.current_value < best;
+        best = improved ? state.current_value : best;
+      }
+      if constexpr (tracks_last)
+        last = state.evaluations;
+      std::apply([&](auto &...r) { (r.log(state, improved), ...); }, runs);
+    }
+    void serialize(checkpoint &ar) noexcept {
+      std::apply([&](auto &...r) { ar(r...); }, runs);
+      ar(last, best);
+    }
+  };
+
+  explicit observer_pipeline(Stages... s) noexcept : stages(s...) {}
+
+  auto open_run(const problem::problem_info<T> &info, int run_id) noexcept {
+    run_type r;
+    r.run_id = run_id;
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (std::get<I>(r.runs).open(std::get<I>(stages).observer, info, run_id),
+       ...);
+    }(std::index_sequence_for<Stages...>());
+    return r;
+  }
+
+  void close_run(run_type &r) noexcept {
+    const problem::problem_state<T> state{.evaluations = r.last,
+                                          .run_id = r.run_id,
+                                          .current_value = r.best,
+                                          .current_x = {}};
+    std::apply([&](auto &...s) { (s.close(state), ...); }, r.runs);
+  }
+};
+
+template <std::floating_point T, typename... Stages>
+inline auto make_pipeline(Stages... stages) noexcept {
+  return observer_pipeline<T, Stages...>(stages...);
+}
+} // namespace sevobench::experiment
@@ -0,0 +1,162 @@
+#pragma once
+
+#include "best_so_far_record.hpp"
+#include <future>
+#include <numeric>
+
+namespace sevobench::experiment {
+// Fixed-target statistics of the recorded runs. A target counts as reached
+// once best-so-far minus the problem's reference value is at most the
+// target; its runtime is the first recorded FES at which that happens.
+template <std::floating_point T> struct problem_runtime {
+  int index = 0;
+  // Per target: expected running time and the fraction of runs that
+  // reached it. A target no run reached has success rate 0 and ERT
+  // numeric_limits<T>::max(), which stays finite under -ffast-math.
+  std::vector<T> ert;
+  std::vector<T> success_rate;
+  // Per budget: fraction of (instance, run, target) triples reached within
+  // that many FES.
+  std::vector<T> ecdf;
+  // Mean of ecdf over the budget grid; on a log-spaced grid, the normalized
+  // area under the ECDF on a log axis.
+  T auc = 0;
+};
+
+template <std::floating_point T> struct runtime_profile {
+  // Descending, as the per-target vectors are ordered.
+  std::vector<T> targets;
+  // Ascending, as the per-budget vectors are ordered.
+  std::vector<int> budgets;
+  std::vector<problem_runtime<T>> problems;
+  // ECDF and AUC over all problems, each problem weighted equally.
+  std::vector<T> ecdf;
+  T auc = 0;
+};
+
+struct zero_reference {
+  constexpr auto operator()(int, int) const noexcept { return 0; }
+};
+
+// Writes to hits[k] the first FES of trace at which targets[k] is reached,
+// or -1. Best-so-far never increases, so each target is a binary search,
+// started where the previous, easier target was reached.
+template <std::floating_point T>
+inline void hitting_times(std::span<const std::pair<int, T>> trace,
+                          std::span<const T> targets, T reference,
+                          std::span<int> hits) noexcept {
+  auto first = trace.begin();
+  for (std::size_t k = 0; k < targets.size(); k++) {
+    const T t = targets[k] + reference;
+    first = std::partition_point(first, trace.end(),
+                                 [=](const auto &p) { return p.second > t; });
+    hits[k] = first == trace.end() ? -1 : first->first;
+  }
+}
+
+namespace detail {
+template <std::floating_point T>
+inline auto problem_statistics(const best_so_far_record<T> &record, int index,
+                               const std::vector<T> &targets,
+                               const std::vector<int> &budgets,
+                               auto &reference) noexcept {
+  const auto nt = targets.size();
+  problem_runtime<T> r{.index = index,
+                       .ert = std::vector<T>(nt),
+                       .success_rate = std::vector<T>(nt),
+                       .ecdf = std::vector<T>(budgets.size()),
+                       .auc = 0};
+  std::vector<T> spent(nt);
+  std::vector<int> reached(nt), hits(nt), sorted_hits;
+  int runs = 0;
+  auto instances = record.at(index);
+  for (int ins = 0; ins < static_cast<int>(instances.size()); ins++) {
+    const auto ref = static_cast<T>(reference(index, ins + 1));
+    for (const auto &trace : instances[ins]) {
+      runs++;
+      hitting_times<T>(trace, targets, ref, hits);
+      const int last = trace.empty() ? 0 : trace.back().first;
+      for (std::size_t k = 0; k < nt; k++) {
+        if (hits[k] < 0) {
+          spent[k] += last;
+          continue;
+        }
+        spent[k] += hits[k];
+        reached[k]++;
+        sorted_hits.push_back(hits[k]);
+      }
+    }
+  }
+  if (runs == 0 || nt == 0)
+    return r;
+  for (std::size_t k = 0; k < nt; k++) {
+    r.ert[k] =
+        reached[k] ? spent[k] / reached[k] : std::numeric_limits<T>::max();
+    r.success_rate[k] = static_cast<T>(reached[k]) / runs;
+  }
+  std::ranges::sort(sorted_hits);
+  const auto total = static_cast<T>(runs * nt);
+  for (std::size_t b = 0; b < budgets.size(); b++)
+    r.ecdf[b] = (std::ranges::upper_bound(sorted_hits, budgets[b]) -
+                 sorted_hits.begin()) /
+                total;
+  if (!budgets.empty())
+    r.auc = std::accumulate(r.ecdf.begin(), r.ecdf.end(), T(0)) /
+            static_cast<T>(budgets.size());
+  return r;
+}
+} // namespace detail
+
+// Aggregates the runs of record over a target grid and a budget grid, one
+// problem per task. reference(problem_index, instance) is the value targets
+// are relative to, e.g. the optimum; by default targets are absolute.
+template <bool parallel = true, std::floating_point T>
+inline auto runtime_analysis(const best_so_far_record<T> &record,
+                             std::vector<T> targets, std::vector<int> budgets,
+                             auto &&reference) noexcept {
+  std::ranges::sort(targets, std::greater<>());
+  std::ranges::sort(budgets);
+  runtime_profile<T> profile{.targets = std::move(targets),
+                             .budgets = std::move(budgets),
+                             .problems = {},
+                             .ecdf = {},
+                             .auc = 0};
+  const auto &index = record.problem_index();
+  profile.problems.resize(index.size());
+  auto task = [&](std::size_t i) {
+    profile.problems[i] = detail::problem_statistics(
+        record, index[i], profile.targets, profile.budgets, reference);
+  };
+  if constexpr (parallel) {
+    parallel_task pt(static_cast<unsigned int>(
+        std::min<std::size_t>(std::thread::hardware_concurrency(),
+                              index.size())));
+    std::vector<std::future<void>> v;
+    v.reserve(index.size());
+    for (std::size_t i = 0; i < index.size(); i++)
+      v.emplace_back(pt.submit(task, i));
+    for (auto &_ : v)
+      _.get();
+  } else {
+    for (std::size_t i = 0; i < index.size(); i++)
+      task(i);
+  }
+  profile.ecdf.assign(profile.budgets.size(), T(0));
+  for (const auto &p : profile.problems)
+    for (std::size_t b = 0; b < p.ecdf.size(); b++)
+      profile.ecdf[b] += p.ecdf[b] / static_cast<T>(profile.problems.size());
+  if (!profile.budgets.empty())
+    profile.auc =
+        std::accumulate(profile.ecdf.begin(), profile.ecdf.end(), T(0)) /
+        static_cast<T>(profile.budgets.size());
+  return profile;
+}
+
+template <bool parallel = true, std::floating_point T>
+inline auto runtime_analysis(const best_so_far_record<T> &record,
+                             std::vector<T> targets,
+                             std::vector<int> budgets) noexcept {
+  return runtime_analysis<parallel>(record, std::move(targets),
+                                    std::move(budgets), zero_reference{});
+}
+} // namespace sevobench::experiment
@@ -0,0 +1,318 @@
+#pragma once
+
+#include "experiment.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace sevobench::experiment {
+// On-disk convergence trace: a file header followed by blocks of at most
+// chunk points, each holding one run's (FES, best-so-far) pairs as two
+// columns. FES are stored as LEB128 varint deltas from the block's first
+// FES, best values as V. Blocks of concurrent runs interleave in the file.
+namespace detail {
+inline constexpr char trace_magic[8] = {'S', 'E', 'V', 'O', 'T', 'R', 'C', 'E'};
+inline constexpr std::uint32_t trace_version = 1;
+inline constexpr std::uint32_t block_magic = 0x4b4c4254; // "TBLK"
+
+struct trace_file_header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t value_size;
+};
+
+struct trace_block_header {
+  std::uint32_t magic;
+  std::int32_t index;
+  std::int32_t instance;
+  std::int32_t dim;
+  std::int32_t run_id;
+  std::uint32_t count;
+  std::int32_t first_fes;
+  std::uint32_t fes_bytes;
+};
+
+inline void put_varint(std::vector<unsigned char> &out,
+                       std::uint32_t x) noexcept {
+  while (x >= 0x80) {
+    out.push_back(static_cast<unsigned char>(x | 0x80));
+    x >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(x));
+}
+
+// Size of the intact part of the trace file at path: its header, if it is a
+// trace of value_size values, and the complete blocks that follow. 0 if the
+// file is missing or not such a trace.
+inline std::uintmax_t trace_intact_size(const std::string &path,
+                                        std::uint32_t value_size) noexcept {
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(path, ec);
+  auto *file = ec ? nullptr : std::fopen(path.c_str(), "rb");
+  if (!file)
+    return 0;
+  std::uintmax_t end = 0;
+  trace_file_header h;
+  if (std::fread(&h, sizeof h, 1, file) == 1 &&
+      std::equal(h.magic, h.magic + 8, trace_magic) &&
+      h.version == trace_version && h.value_size == value_size) {
+    end = sizeof h;
+    trace_block_header b;
+    while (std::fread(&b, sizeof b, 1, file) == 1 && b.magic == block_magic) {
+      const auto next = end + sizeof b + b.fes_bytes +
+                        std::uintmax_t(b.count) * value_size;
+      if (b.count == 0 || next > size ||
+          std::fseek(file, static_cast<long>(next), SEEK_SET) != 0)
+        break;
+      end = next;
+    }
+  }
+  std::fclose(file);
+  return end;
+}
+
+// Returns the position after the varint, or nullptr if it runs past last.
+inline const unsigned char *get_varint(const unsigned char *p,
+                                       const unsigned char *last,
+                                       std::uint32_t &x) noexcept {
+  x = 0;
+  for (int shift = 0; p != last && shift < 35; shift += 7) {
+    x |= std::uint32_t(*p & 0x7f) << shift;
+    if (!(*p++ & 0x80))
+      return p;
+  }
+  return nullptr;
+}
+} // namespace detail
+
+template <std::floating_point V = float> struct trace_block {
+  int index = 0;
+  int instance = 0;
+  int dim = 0;
+  int run_id = 0;
+  std::vector<int> fes;
+  std::vector<V> best;
+};
+
+// Run observer that streams best-so-far traces to a file instead of keeping
+// them: every run buffers at most chunk points, then appends them as one
+// block. Memory stays bounded by chunk points per concurrent run.
+//
+// For a benchmark resumed from checkpoints, open the writer with append:
+// runs checkpoint their buffered points, and a resumed run rewrites the
+// blocks it wrote after its checkpoint, which trace_reader::read_all then
+// takes over the earlier copies.
+template <std::floating_point T, std::floating_point V = float>
+class trace_writer {
+  std::FILE *file = nullptr;
+  std::mutex mut;
+  const int max_fes_;
+  const int step_;
+  const int chunk_;
+
+  void write(const detail::trace_block_header &h,
+             const std::vector<unsigned char> &fes,
+             const std::vector<V> &best) noexcept {
+    std::lock_guard<std::mutex> lck(mut);
+    if (!file)
+      return;
+    std::fwrite(&h, sizeof h, 1, file);
+    std::fwrite(fes.data(), 1, fes.size(), file);
+    std::fwrite(best.data(), sizeof(V), best.size(), file);
+  }
+
+public:
+  using value_type = T;
+
+  struct run_type {
+    trace_writer *writer = nullptr;
+    detail::trace_block_header header{};
+    T best = std::numeric_limits<T>::max();
+    int last_fes = 0;
+    std::vector<unsigned char> fes{};
+    std::vector<V> values{};
+
+    void flush() noexcept {
+      if (values.empty())
+        return;
+      header.count = static_cast<std::uint32_t>(values.size());
+      header.fes_bytes = static_cast<std::uint32_t>(fes.size());
+      writer->write(header, fes, values);
+      fes.clear();
+      values.clear();
+    }
+
+    // The writer itself is not part of the run's state.
+    void serialize(checkpoint &ar) noexcept {
+      ar(best, last_fes, header.first_fes, fes, values);
+    }
+
+    void log(const problem::problem_state<T> &state) noexcept {
+      best = std::min(best, state.current_value);
+      if (state.evaluations % writer->step_ != 0 ||
+          state.evaluations > writer->max_fes_)
+        return;
+      if (values.empty())
+        header.first_fes = state.evaluations;
+      else
+        detail::put_varint(fes, std::uint32_t(state.evaluations - last_fes));
+      last_fes = state.evaluations;
+      values.push_back(static_cast<V>(best));
+      if (static_cast<int>(values.size()) == writer->chunk_)
+        flush();
+    }
+  };
+
+  // Records best-so-far every step evaluations up to max_fes. With append,
+  // an existing trace of V values is kept, minus any block cut short when
+  // its writer was killed, and new blocks go after it.
+  trace_writer(const std::string &path, int max_fes, int step,
+               int chunk = 4096, bool append = false) noexcept
+      : max_fes_(max_fes), step_(step), chunk_(std::max(chunk, 1)) {
+    if (append) {
+      if (auto end = detail::trace_intact_size(path, sizeof(V)); end > 0) {
+        std::error_code ec;
+        std::filesystem::resize_file(path, end, ec);
+        file = ec ? nullptr : std::fopen(path.c_str(), "ab");
+        return;
+      }
+    }
+    file = std::fopen(path.c_str(), "wb");
+    if (!file)
+      return;
+    detail::trace_file_header h{};
+    std::copy_n(detail::trace_magic, 8, h.magic);
+    h.version = detail::trace_version;
+    h.value_size = sizeof(V);
+    std::fwrite(&h, sizeof h, 1, file);
+  }
+  trace_writer(const trace_writer &) = delete;
+  trace_writer &operator=(const trace_writer &) = delete;
+  ~trace_writer() { close(); }
+
+  auto good() const noexcept { return file != nullptr; }
+
+  // Flushes the file; called by the destructor.
+  void close() noexcept {
+    std::lock_guard<std::mutex> lck(mut);
+    if (file)
+      std::fclose(file);
+    file = nullptr;
+  }
+
+  auto open_run(const problem::problem_info<T> &info, int run_id) noexcept {
+    run_type r;
+    r.writer = this;
+    r.header = {.magic = detail::block_magic,
+                .index = info.index,
+                .instance = info.instance,
+                .dim = info.dim,
+                .run_id = run_id,
+                .count = 0,
+                .first_fes = 0,
+                .fes_bytes = 0};
+    return r;
+  }
+
+  // evo_bench opens every run up front, so buffers are only allocated once
+  // a run logs and are released when it closes.
+  void close_run(run_type &r) noexcept {
+    r.flush();
+    r.fes = {};
+    r.values = {};
+  }
+};
+
+// Reads a trace_writer file back one block at a time.
+template <std::floating_point V = float> class trace_reader {
+  std::FILE *file = nullptr;
+  bool good_ = false;
+  std::vector<unsigned char> buf;
+
+public:
+  explicit trace_reader(const std::string &path) noexcept
+      : file(std::fopen(path.c_str(), "rb")) {
+    detail::trace_file_header h;
+    good_ = file && std::fread(&h, sizeof h, 1, file) == 1 &&
+            std::equal(h.magic, h.magic + 8, detail::trace_magic) &&
+            h.version == detail::trace_version && h.value_size == sizeof(V);
+  }
+  trace_reader(const trace_reader &) = delete;
+  trace_reader &operator=(const trace_reader &) = delete;
+  ~trace_reader() {
+    if (file)
+      std::fclose(file);
+  }
+
+  // Whether the file is a trace of V values and no damaged block was met.
+  auto good() const noexcept { return good_; }
+
+  // Reads the next block into b; false at the end of the file or on a
+  // damaged block, which also clears good().
+  bool next(trace_block<V> &b) noexcept {
+    if (!good_)
+      return false;
+    detail::trace_block_header h;
+    if (std::fread(&h, sizeof h, 1, file) != 1)
+      return false;
+    if (h.magic != detail::block_magic || h.count == 0 ||
+        h.count > (1u << 26) || h.fes_bytes > 5 * std::size_t(h.count)) {
+      good_ = false;
+      return false;
+    }
+    buf.resize(h.fes_bytes);
+    b.index = h.index;
+    b.instance = h.instance;
+    b.dim = h.dim;
+    b.run_id = h.run_id;
+    b.fes.resize(h.count);
+    b.best.resize(h.count);
+    if (std::fread(buf.data(), 1, buf.size(), file) != buf.size() ||
+        std::fread(b.best.data(), sizeof(V), h.count, file) != h.count) {
+      good_ = false;
+      return false;
+    }
+    const unsigned char *p = buf.data();
+    const unsigned char *last = p + buf.size();
+    b.fes[0] = h.first_fes;
+    for (std::uint32_t i = 1; i < h.count; i++) {
+      std::uint32_t d;
+      if (!(p = detail::get_varint(p, last, d))) {
+        good_ = false;
+        return false;
+      }
+      b.fes[i] = b.fes[i - 1] + static_cast<int>(d);
+    }
+    return true;
+  }
+
+  // Whole traces keyed by (problem index, instance, dim, run id), with the
+  // blocks of each run joined in order. A block starting at or before the
+  // last FES read for its run replaces the points from its first FES on,
+  // as a run resumed from a checkpoint rewrites them.
+  auto read_all() noexcept {
+    std::map<std::tuple<int, int, int, int>, trace_block<V>> runs;
+    trace_block<V> b;
+    while (next(b)) {
+      auto &r = runs[{b.index, b.instance, b.dim, b.run_id}];
+      if (r.fes.empty()) {
+        r.index = b.index;
+        r.instance = b.instance;
+        r.dim = b.dim;
+        r.run_id = b.run_id;
+      } else if (b.fes[0] <= r.fes.back()) {
+        const auto keep = std::ranges::lower_bound(r.fes, b.fes[0]) -
+                          r.fes.begin();
+        r.fes.resize(keep);
+        r.best.resize(keep);
+      }
+      r.fes.insert(r.fes.end(), b.fes.begin(), b.fes.end());
+      r.best.insert(r.best.end(), b.best.begin(), b.best.end());
+    }
+    return runs;
+  }
+};
+} // namespace sevobench::experiment
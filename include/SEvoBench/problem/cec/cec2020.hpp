@@ -3,6 +3,7 @@
 #include "cec2017.hpp"
 namespace sevobench::problem {
 template <int Prob_Index, int Dim, std::floating_point T> struct cec2020;
+template <> inline constexpr bool has_runtime_dim<cec2020> = true;
 
 template <int Dim, std::floating_point T>
 struct cec2020<1, Dim, T> : public cec2017<1, Dim, T> {
@@ -10,6 +11,8 @@ struct cec2020<1, Dim, T> : public cec2017<1, Dim, T> {
 
   cec2020(const std::string &dir_name)
       : cec2017<1, Dim, T>(dir_name, index()) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<1, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 1; }
 
@@ -28,6 +31,8 @@ struct cec2020<2, Dim, T> : public cec2014<11, Dim, T> {
 
   cec2020(const std::string &dir_name)
       : cec2014<11, Dim, T>(dir_name, index()) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2014<11, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 2; }
 
@@ -46,6 +51,8 @@ struct cec2020<3, Dim, T> : public cec2017<7, Dim, T> {
 
   cec2020(const std::string &dir_name)
       : cec2017<7, Dim, T>(dir_name, index()) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<7, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 3; }
 
@@ -63,9 +70,11 @@ struct cec2020<4, Dim, T> : public cec_common<4, Dim, T, cec2020> {
   using cec_common<4, Dim, T, cec2020>::cec_common;
   cec2020(const std::string &dir_name)
       : cec_common<4, Dim, T, cec2020>(dir_name, 7) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec_common<4, Dim, T, cec2020>(dir_name, 7, d) {}
   static constexpr auto optimum_num() { return 1900; }
-  static auto evaluate(std::span<T, Dim> x) {
-    return cec_detail::grie_rosen_func<T, Dim>(x);
+  static auto evaluate(cec_detail::dim_span<T, Dim> x) {
+    return cec_detail::grie_rosen_func<T>(x);
   }
 };
 template <int Dim, std::floating_point T>
@@ -73,6 +82,8 @@ struct cec2020<5, Dim, T> : public cec2014<17, Dim, T> {
   using cec2014<17, Dim, T>::cec2014;
 
   cec2020(const std::string &dir_name) : cec2014<17, Dim, T>(dir_name, 4) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2014<17, Dim, T>(dir_name, 4, d) {}
 
   static constexpr auto index() { return 5; }
 
@@ -90,6 +101,8 @@ struct cec2020<6, Dim, T> : public cec2017<16, Dim, T> {
   using cec2017<16, Dim, T>::cec2017;
 
   cec2020(const std::string &dir_name) : cec2017<16, Dim, T>(dir_name, 16) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<16, Dim, T>(dir_name, 16, d) {}
 
   static constexpr auto index() { return 6; }
 
@@ -107,6 +120,8 @@ struct cec2020<7, Dim, T> : public cec2014<21, Dim, T> {
   using cec2014<21, Dim, T>::cec2014;
 
   cec2020(const std::string &dir_name) : cec2014<21, Dim, T>(dir_name, 6) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2014<21, Dim, T>(dir_name, 6, d) {}
 
   static constexpr auto index() { return 7; }
 
@@ -124,6 +139,8 @@ struct cec2020<8, Dim, T> : public cec2017<22, Dim, T> {
   using cec2017<22, Dim, T>::cec2017;
 
   cec2020(const std::string &dir_name) : cec2017<22, Dim, T>(dir_name, 22) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<22, Dim, T>(dir_name, 22, d) {}
 
   static constexpr auto index() { return 8; }
 
@@ -141,6 +158,8 @@ struct cec2020<9, Dim, T> : public cec2017<24, Dim, T> {
   using cec2017<24, Dim, T>::cec2017;
 
   cec2020(const std::string &dir_name) : cec2017<24, Dim, T>(dir_name, 24) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<24, Dim, T>(dir_name, 24, d) {}
 
   static constexpr auto index() { return 9; }
 
@@ -158,6 +177,8 @@ struct cec2020<10, Dim, T> : public cec2017<25, Dim, T> {
   using cec2017<25, Dim, T>::cec2017;
 
   cec2020(const std::string &dir_name) : cec2017<25, Dim, T>(dir_name, 25) {}
+  cec2020(int d, const std::string &dir_name)
+      : cec2017<25, Dim, T>(dir_name, 25, d) {}
 
   static constexpr auto index() { return 10; }
 
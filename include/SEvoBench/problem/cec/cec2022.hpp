@@ -5,6 +5,7 @@
 
 namespace sevobench::problem {
 template <int Prob_Index, int Dim, std::floating_point T> struct cec2022;
+template <> inline constexpr bool has_runtime_dim<cec2022> = true;
 
 template <int Dim, std::floating_point T>
 struct cec2022<1, Dim, T> : public cec2017<3, Dim, T> {
@@ -12,6 +13,8 @@ struct cec2022<1, Dim, T> : public cec2017<3, Dim, T> {
 
   cec2022(const std::string &dir_name)
       : cec2017<3, Dim, T>(dir_name, index()) {}
+  cec2022(int d, const std::string &dir_name)
+      : cec2017<3, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 1; }
   auto problem_information() const noexcept {
@@ -30,6 +33,8 @@ struct cec2022<2, Dim, T> : public cec2017<4, Dim, T> {
 
   cec2022(const std::string &dir_name)
       : cec2017<4, Dim, T>(dir_name, index()) {}
+  cec2022(int d, const std::string &dir_name)
+      : cec2017<4, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 2; }
   auto problem_information() const noexcept {
@@ -48,6 +53,8 @@ struct cec2022<3, Dim, T> : public cec2017<6, Dim, T> {
 
   cec2022(const std::string &dir_name)
       : cec2017<6, Dim, T>(dir_name, index()) {}
+  cec2022(int d, const std::string &dir_name)
+      : cec2017<6, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 3; }
   auto problem_information() const noexcept {
@@ -66,6 +73,8 @@ struct cec2022<4, Dim, T> : public cec2017<8, Dim, T> {
 
   cec2022(const std::string &dir_name)
       : cec2017<8, Dim, T>(dir_name, index()) {}
+  cec2022(int d, const std::string &dir_name)
+      : cec2017<8, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 4; }
   auto problem_information() const noexcept {
@@ -84,6 +93,8 @@ struct cec2022<5, Dim, T> : public cec2017<9, Dim, T> {
 
   cec2022(const std::string &dir_name)
       : cec2017<9, Dim, T>(dir_name, index()) {}
+  cec2022(int d, const std::string &dir_name)
+      : cec2017<9, Dim, T>(dir_name, index(), d) {}
 
   static constexpr auto index() { return 5; }
   auto problem_information() const noexcept {
@@ -99,15 +110,15 @@ struct cec2022<5, Dim, T> : public cec2017<9, Dim, T> {
 template <int Dim, std::floating_point T>
 struct cec2022<7, Dim, T> : public cec_common<7, Dim, T, cec2022> {
   using cec_common<7, Dim, T, cec2022>::cec_common;
-  static auto hybrid_evaluate(std::span<T, Dim> x) {
-    return cec_detail::calculate_hybrid<Dim>(
-        x,
-        std::to_array<std::pair<int, int>>(
-            {{1, 10}, {1, 5}, {1, 5}, {1, 5}, {1, 10}, {1, 5}}),
-        std::to_array<T (*)(std::span<T>)>(
-            {cec_detail::hgbat_func<T>, cec_detail::katsuura_func<T>,
-             cec_detail::ackley_func<T>, cec_detail::rastrigin_func<T>,
-             cec_detail::schwefel_func<T>, cec_detail::schwefel_F7_func<T>}));
+  static auto hybrid_evaluate(cec_detail::dim_span<T, Dim> x) {
+    return cec_detail::calculate_hybrid<
+        Dim, T,
+        cec_detail::hybrid_part<1, 10, cec_detail::basic::hgbat>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::katsuura>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::ackley>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::rastrigin>,
+        cec_detail::hybrid_part<1, 10, cec_detail::basic::schwefel>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::schwefel_F7>>(x);
   }
   static constexpr auto optimum_num() { return T(2000); }
 };
@@ -121,19 +132,20 @@ struct cec2022<9, Dim, T> : public cec_common<9, Dim, T, cec2022> {
     constexpr auto lams = std::to_array<T>({1, 1e-6, 1e-26, 1e-6, 1e-6});
     constexpr auto biases = std::to_array<T>({0, 200, 300, 100, 400});
     constexpr auto deltas = std::to_array<T>({10, 20, 30, 40, 50});
-    constexpr auto f = std::to_array<T (*)(std::span<T, Dim>)>(
-        {cec_detail::rosenbrock_func<T, Dim>, cec_detail::ellips_func<T, Dim>,
-         cec_detail::bent_cigar_func<T, Dim>, cec_detail::discus_func<T, Dim>,
-         cec_detail::ellips_func<T, Dim>});
+    constexpr auto f = std::to_array<T (*)(cec_detail::dim_span<T, Dim>)>(
+        {cec_detail::rosenbrock_func<T>, cec_detail::ellips_func<T>,
+         cec_detail::bent_cigar_func<T>, cec_detail::discus_func<T>,
+         cec_detail::ellips_func<T>});
     std::array<T, cf_num()> fits;
-    std::array<T, Dim> tmp_x;
+    const int n = cec_detail::dim_of<Dim>(x);
+    cec_detail::dim_array<T, Dim> tmp_x(n);
     for (int i = 0; i < cf_num(); i++) {
       if (i != cf_num() - 1) {
-        cec_detail::sr_func<Dim, false, T>(x, tmp_x, y.subspan(i * Dim),
-                                           z.subspan(i * Dim * Dim));
+        cec_detail::sr_func<Dim, false, T>(x, tmp_x, y.subspan(i * n),
+                                           z.subspan(i * n * n));
       } else {
-        cec_detail::sr_func<Dim, true, T>(x, tmp_x, y.subspan(i * Dim),
-                                          z.subspan(i * Dim * Dim));
+        cec_detail::sr_func<Dim, true, T>(x, tmp_x, y.subspan(i * n),
+                                          z.subspan(i * n * n));
       }
       fits[i] = lams[i] * f[i](tmp_x) + biases[i];
     }
@@ -152,15 +164,16 @@ struct cec2022<10, Dim, T> : public cec_common<10, Dim, T, cec2022> {
     constexpr auto deltas = std::to_array<T>({20, 10, 10});
     constexpr auto lams = std::to_array<T>({1, 1, 1});
     constexpr auto biases = std::to_array<T>({0, 200, 100});
-    constexpr auto f = std::to_array<T (*)(std::span<T, Dim>)>(
-        {cec_detail::schwefel_func<T, Dim>, cec_detail::rastrigin_func<T, Dim>,
-         cec_detail::hgbat_func<T, Dim>});
+    constexpr auto f = std::to_array<T (*)(cec_detail::dim_span<T, Dim>)>(
+        {cec_detail::schwefel_func<T>, cec_detail::rastrigin_func<T>,
+         cec_detail::hgbat_func<T>});
     std::array<T, cf_num()> fits;
-    std::array<T, Dim> tmp_x;
+    const int n = cec_detail::dim_of<Dim>(x);
+    cec_detail::dim_array<T, Dim> tmp_x(n);
     for (int i = 0; i < cf_num(); i++) {
       if (i != 0) {
-        cec_detail::sr_func<Dim, false, T>(x, tmp_x, y.subspan(i * Dim),
-                                           z.subspan(i * Dim * Dim));
+        cec_detail::sr_func<Dim, false, T>(x, tmp_x, y.subspan(i * n),
+                                           z.subspan(i * n * n));
       } else {
         cec_detail::sr_func<Dim, true, T>(x, tmp_x, y, z);
       }
@@ -175,20 +188,22 @@ struct cec2022<10, Dim, T> : public cec_common<10, Dim, T, cec2022> {
 template <int Dim, std::floating_point T>
 struct cec2022<11, Dim, T> : public cec_common<11, Dim, T, cec2022> {
   using cec_common<11, Dim, T, cec2022>::cec_common;
+  static constexpr auto components() {
+    return cec_detail::make_components<Dim, false>(
+        std::to_array<T>({20, 20, 30, 30, 20}),
+        std::to_array<T>({5e-4, 1, 10, 1, 10}),
+        std::to_array<T>({0, 200, 300, 400, 200}),
+        std::to_array<T (*)(cec_detail::dim_span<T, Dim>)>(
+            {cec_detail::escaffer6_func<T>,
+             cec_detail::schwefel_func<T>,
+             cec_detail::griewank_func<T>,
+             cec_detail::rosenbrock_func<T>,
+             cec_detail::rastrigin_func<T>}));
+  }
   static auto composition_evaluate(std::span<const T> x, std::span<const T> y,
                                    std::span<const T> z,
                                    std::span<const int> s) {
-    return cec_detail::calculate_composition<Dim, false>(
-        x, std::to_array<T>({20, 20, 30, 30, 20}),
-        std::to_array<T>({5e-4, 1, 10, 1, 10}),
-        std::to_array<T>({0, 200, 300, 400, 200}),
-        std::to_array<T (*)(std::span<T, Dim>)>(
-            {cec_detail::escaffer6_func<T, Dim>,
-             cec_detail::schwefel_func<T, Dim>,
-             cec_detail::griewank_func<T, Dim>,
-             cec_detail::rosenbrock_func<T, Dim>,
-             cec_detail::rastrigin_func<T, Dim>}),
-        y, z, s);
+    return cec_detail::calculate_composition(x, components(), y, z, s);
   }
   static constexpr auto cf_num() { return 5; }
   static constexpr auto optimum_num() { return T(2600); }
@@ -197,20 +212,22 @@ struct cec2022<11, Dim, T> : public cec_common<11, Dim, T, cec2022> {
 template <int Dim, std::floating_point T>
 struct cec2022<12, Dim, T> : public cec_common<12, Dim, T, cec2022> {
   using cec_common<12, Dim, T, cec2022>::cec_common;
+  static constexpr auto components() {
+    return cec_detail::make_components<Dim, false>(
+        std::to_array<T>({10, 20, 30, 40, 50, 60}),
+        std::to_array<T>({10, 10, 2.5, 1e-26, 1e-6, 5e-4}),
+        std::to_array<T>({0, 300, 500, 100, 400, 200}),
+        std::to_array<T (*)(cec_detail::dim_span<T, Dim>)>(
+            {cec_detail::hgbat_func<T>, cec_detail::rastrigin_func<T>,
+             cec_detail::schwefel_func<T>,
+             cec_detail::bent_cigar_func<T>,
+             cec_detail::ellips_func<T>,
+             cec_detail::escaffer6_func<T>}));
+  }
   static auto composition_evaluate(std::span<const T> x, std::span<const T> y,
                                    std::span<const T> z,
                                    std::span<const int> s) {
-    return cec_detail::calculate_composition<Dim, false>(
-        x, std::to_array<T>({10, 20, 30, 40, 50, 60}),
-        std::to_array<T>({10, 10, 2.5, 1e-26, 1e-6, 5e-4}),
-        std::to_array<T>({0, 300, 500, 100, 400, 200}),
-        std::to_array<T (*)(std::span<T, Dim>)>(
-            {cec_detail::hgbat_func<T, Dim>, cec_detail::rastrigin_func<T, Dim>,
-             cec_detail::schwefel_func<T, Dim>,
-             cec_detail::bent_cigar_func<T, Dim>,
-             cec_detail::ellips_func<T, Dim>,
-             cec_detail::escaffer6_func<T, Dim>}),
-        y, z, s);
+    return cec_detail::calculate_composition(x, components(), y, z, s);
   }
   static constexpr auto cf_num() { return 6; }
   static constexpr auto optimum_num() { return T(2700); }
@@ -218,27 +235,26 @@ struct cec2022<12, Dim, T> : public cec_common<12, Dim, T, cec2022> {
 template <int Dim, std::floating_point T>
 struct cec2022<6, Dim, T> : public cec_common<6, Dim, T, cec2022> {
   using cec_common<6, Dim, T, cec2022>::cec_common;
-  static auto hybrid_evaluate(std::span<T, Dim> x) {
-    return cec_detail::calculate_hybrid<Dim>(
-        x, std::to_array<std::pair<int, int>>({{2, 5}, {2, 5}, {1, 5}}),
-        std::to_array<T (*)(std::span<T>)>({cec_detail::bent_cigar_func<T>,
-                                            cec_detail::hgbat_func<T>,
-                                            cec_detail::rastrigin_func<T>}));
+  static auto hybrid_evaluate(cec_detail::dim_span<T, Dim> x) {
+    return cec_detail::calculate_hybrid<
+        Dim, T,
+        cec_detail::hybrid_part<2, 5, cec_detail::basic::bent_cigar>,
+        cec_detail::hybrid_part<2, 5, cec_detail::basic::hgbat>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::rastrigin>>(x);
   }
   static constexpr auto optimum_num() { return T(1800); }
 };
 template <int Dim, std::floating_point T>
 struct cec2022<8, Dim, T> : public cec_common<8, Dim, T, cec2022> {
   using cec_common<8, Dim, T, cec2022>::cec_common;
-  static auto hybrid_evaluate(std::span<T, Dim> x) {
-    return cec_detail::calculate_hybrid<Dim>(
-        x,
-        std::to_array<std::pair<int, int>>(
-            {{3, 10}, {1, 5}, {1, 5}, {1, 10}, {1, 5}}),
-        std::to_array<T (*)(std::span<T>)>(
-            {cec_detail::katsuura_func<T>, cec_detail::happycat_func<T>,
-             cec_detail::grie_rosen_func<T>, cec_detail::schwefel_func<T>,
-             cec_detail::ackley_func<T>}));
+  static auto hybrid_evaluate(cec_detail::dim_span<T, Dim> x) {
+    return cec_detail::calculate_hybrid<
+        Dim, T,
+        cec_detail::hybrid_part<3, 10, cec_detail::basic::katsuura>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::happycat>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::grie_rosen>,
+        cec_detail::hybrid_part<1, 10, cec_detail::basic::schwefel>,
+        cec_detail::hybrid_part<1, 5, cec_detail::basic::ackley>>(x);
   }
   static constexpr auto optimum_num() { return T(2200); }
 };
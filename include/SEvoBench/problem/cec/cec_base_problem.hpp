@@ -1,11 +1,66 @@
 #pragma once
 #include "../../common/tool.hpp"
+#include "../dispatch/kernel_registry.hpp"
+#include "cec_base_problem_simd.hpp"
+#include "../problem.hpp"
 
 namespace sevobench::problem::cec_detail {
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+// Extent of the vectors of a problem of dimension Dim.
+template <int Dim>
+inline constexpr std::size_t extent =
+    Dim == runtime_dim ? std::dynamic_extent : std::size_t(Dim);
+
+template <typename T, int Dim> using dim_span = std::span<T, extent<Dim>>;
+
+// Dimension of x, a constant unless Dim is runtime_dim.
+template <int Dim> constexpr int dim_of(auto x) noexcept {
+  if constexpr (Dim == runtime_dim)
+    return static_cast<int>(x.size());
+  else
+    return Dim;
+}
+
+// Scratch vector of a problem's dimension. For runtime_dim it lives on the
+// stack up to inline_dim and on the heap beyond.
+template <std::floating_point T, int Dim>
+struct dim_array : public std::array<T, Dim> {
+  explicit dim_array(int) noexcept {}
+};
+
+template <std::floating_point T> class dim_array<T, runtime_dim> {
+  static constexpr int inline_dim = 128;
+  std::array<T, inline_dim> local;
+  std::vector<T> heap;
+  T *p;
+  int n;
+
+public:
+  explicit dim_array(int dim) noexcept
+      : heap(dim > inline_dim ? dim : 0),
+        p(dim > inline_dim ? heap.data() : local.data()), n(dim) {}
+  dim_array(const dim_array &) = delete;
+  dim_array &operator=(const dim_array &) = delete;
+  auto data() noexcept { return p; }
+  auto data() const noexcept { return static_cast<const T *>(p); }
+  auto size() const noexcept { return static_cast<std::size_t>(n); }
+  auto begin() noexcept { return p; }
+  auto end() noexcept { return p + n; }
+  auto &operator[](std::size_t i) noexcept { return p[i]; }
+  const auto &operator[](std::size_t i) const noexcept { return p[i]; }
+};
+
+// The basic functions. Without Dispatch they skip the kernel registry and
+// run the kernel compiled into this translation unit.
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto zakharov_func(std::span<T, M> y) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? y.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.zakharov(y.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::zakharov<simd_type<T>>(y.data(), N);
   T sum1(0);
   T sum2(0);
   for (int i = 0; i < N; i++) {
@@ -15,10 +70,16 @@ inline auto zakharov_func(std::span<T, M> y) noexcept {
   return sum1 + tool::Pow<2>(sum2) + tool::Pow<4>(sum2);
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto sum_diff_pow_func(std::span<T, M> y) noexcept {
   T sum = 0;
   const auto N = static_cast<int>((M == std::dynamic_extent) ? y.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.sum_diff_pow(y.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::sum_diff_pow<simd_type<T>>(y.data(), N);
   for (int i = 0; i < N; i++) {
     T newv = std::pow(std::abs(y[i]), (i + 1));
     sum += newv;
@@ -26,21 +87,34 @@ inline auto sum_diff_pow_func(std::span<T, M> y) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto rosenbrock_func(std::span<T, M> t) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? t.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.rosenbrock(t.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::rosenbrock<simd_type<T>>(t.data(), N);
   T sum(0);
-  for (int i = 0; i < N; i++)
-    t[i] = T(1) + T(0.02048) * t[i];
-  for (int i = 0; i < N - 1; i++)
-    sum +=
-        tool::Pow<2>(t[i] - 1) + 100 * tool::Pow<2>((t[i + 1] - t[i] * t[i]));
+  T t0 = T(1) + T(0.02048) * t[0];
+  for (int i = 0; i < N - 1; i++) {
+    const T t1 = T(1) + T(0.02048) * t[i + 1];
+    sum += tool::Pow<2>(t0 - 1) + 100 * tool::Pow<2>((t1 - t0 * t0));
+    t0 = t1;
+  }
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto escaffer6_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.escaffer6(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::escaffer6<simd_type<T>>(z.data(), N);
   T sum(0);
   for (int i = 0; i < N - 1; i++) {
     T temp1 = std::sin(std::sqrt(z[i] * z[i] + z[i + 1] * z[i + 1]));
@@ -55,9 +129,15 @@ inline auto escaffer6_func(std::span<T, M> z) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto rastrigin_func(std::span<T, M> _x) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? _x.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.rastrigin(_x.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::rastrigin<simd_type<T>>(_x.data(), N);
   return 10 * N +
          std::accumulate(_x.begin(), _x.end(), T(0), [](auto l, auto r) {
            r *= T(0.0512);
@@ -65,9 +145,15 @@ inline auto rastrigin_func(std::span<T, M> _x) noexcept {
          });
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto levy_func(std::span<T, M> x) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? x.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.levy(x.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::levy<simd_type<T>>(x.data(), N);
   auto sum =
       tool::Pow<2>(std::sin(std::numbers::pi_v<T> * (1 + T(0.25) * (x[0]))));
   for (int i = 0; i < N - 1; i++) {
@@ -81,23 +167,33 @@ inline auto levy_func(std::span<T, M> x) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto bent_cigar_func(std::span<T, M> x) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? x.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.bent_cigar(x.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::bent_cigar<simd_type<T>>(x.data(), N);
   T sum(0);
   for (int i = 1; i < N; i++)
     sum += x[i] * x[i];
   return x[0] * x[0] + 1000000 * sum;
 }
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto hgbat_func(std::span<T, M> x) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? x.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.hgbat(x.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::hgbat<simd_type<T>>(x.data(), N);
   T sum1(0);
   T sum2(0);
-  for (int i = 0; i < N; i++)
-    x[i] *= T(0.05);
   for (int i = 0; i < N; i++) {
-    auto z = x[i] - 1;
+    auto z = T(0.05) * x[i] - 1;
     sum1 += z * z;
     sum2 += z;
   }
@@ -105,7 +201,8 @@ inline auto hgbat_func(std::span<T, M> x) noexcept {
          (T(0.5) * sum1 + sum2) / N + T(0.5);
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto katsuura_func(std::span<T, M> z) noexcept {
   constexpr T b[] = {T(2),         T(4),          T(8),          T(16),
                      T(32),        T(64),         T(128),        T(256),
@@ -116,15 +213,19 @@ inline auto katsuura_func(std::span<T, M> z) noexcept {
                      T(33554432),  T(67108864),   T(134217728),  T(268435456),
                      T(536870912), T(1073741824), T(2147483648), T(4294967296)};
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.katsuura(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::katsuura<simd_type<T>>(z.data(), N);
   T sum(1);
   T tmp3 = std::pow(T(N), T(1.2));
-  for (int i = 0; i < N; i++)
-    z[i] *= T(0.05);
   for (int i = 0; i < N; i++) {
+    const T zi = T(0.05) * z[i];
     T temp(0);
     for (int j = 1; j <= 32; j++) {
       T tmp1 = b[j - 1];
-      T tmp2 = tmp1 * z[i];
+      T tmp2 = tmp1 * zi;
       temp += std::abs(tmp2 - std::floor(tmp2 + T(0.5))) / tmp1;
     }
     sum *= std::pow(T(1) + (i + 1) * temp, T(10) / tmp3);
@@ -134,9 +235,15 @@ inline auto katsuura_func(std::span<T, M> z) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto ackley_func(std::span<T, M> _x) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? _x.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.ackley(_x.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::ackley<simd_type<T>>(_x.data(), N);
   T sum(T(0));
   T sqsum(T(0));
   for (int i = 0; i < N; i++) {
@@ -147,14 +254,18 @@ inline auto ackley_func(std::span<T, M> _x) noexcept {
          20 * std::exp(T(-0.2) * std::sqrt(sqsum / N));
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto schwefel_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.schwefel(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::schwefel<simd_type<T>>(z.data(), N);
   T sum(0);
-  for (int i = 0; i < N; i++)
-    z[i] *= T(10);
   for (int i = 0; i < N; i++) {
-    T x(z[i] + T(420.9687462275036));
+    T x(T(10) * z[i] + T(420.9687462275036));
     if (x > T(500)) {
       sum -= (T(500) - std::fmod(x, T(500))) *
              std::sin(std::sqrt(std::abs(500 - std::fmod(x, T(500)))));
@@ -173,9 +284,15 @@ inline auto schwefel_func(std::span<T, M> z) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto schwefel_F7_func(std::span<T, M> y) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? y.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.schwefel_F7(y.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::schwefel_F7<simd_type<T>>(y.data(), N);
   T sum(0);
   for (int i = 0; i < N - 1; i++) {
     auto x = std::sqrt(y[i] * y[i] + y[i + 1] * y[i + 1]);
@@ -186,15 +303,19 @@ inline auto schwefel_F7_func(std::span<T, M> y) noexcept {
   return sum;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto happycat_func(std::span<T, M> y) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? y.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.happycat(y.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::happycat<simd_type<T>>(y.data(), N);
   T sum1(0);
   T sum2(0);
-  for (int i = 0; i < N; i++)
-    y[i] *= T(0.05);
   for (int i = 0; i < N; i++) {
-    auto z = y[i] - 1;
+    auto z = T(0.05) * y[i] - 1;
     sum1 += z * z;
     sum2 += z;
   }
@@ -202,51 +323,70 @@ inline auto happycat_func(std::span<T, M> y) noexcept {
          T(0.5);
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto grie_rosen_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.grie_rosen(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::grie_rosen<simd_type<T>>(z.data(), N);
   T sum(0);
-  for (int i = 0; i < N; i++)
-    z[i] *= T(0.05);
-  z[0] += 1;
-  for (int i = 0; i < N - 1; i++) {
-    z[i + 1] += 1;
-    auto tmp1 = z[i] * z[i] - z[i + 1];
-    auto tmp2 = z[i] - 1;
+  const T z0 = T(0.05) * z[0] + 1;
+  T zi = z0;
+  for (int i = 0; i < N; i++) {
+    const T zj = i + 1 < N ? T(0.05) * z[i + 1] + 1 : z0;
+    auto tmp1 = zi * zi - zj;
+    auto tmp2 = zi - 1;
     auto temp = T(100) * tmp1 * tmp1 + tmp2 * tmp2;
     sum += (temp * temp) / T(4000) - std::cos(temp) + T(1);
+    zi = zj;
   }
-  auto tmp1 = z[N - 1] * z[N - 1] - z[0];
-  auto tmp2 = z[N - 1] - 1;
-  auto temp = T(100) * tmp1 * tmp1 + tmp2 * tmp2;
-  sum += (temp * temp) / T(4000) - std::cos(temp) + T(1);
   return sum;
 }
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto griewank_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.griewank(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::griewank<simd_type<T>>(z.data(), N);
   T s(0);
   T p(1);
-  for (int i = 0; i < N; i++)
-    z[i] *= T(6);
   for (int i = 0; i < N; i++) {
-    s += z[i] * z[i];
-    p *= std::cos(z[i] / std::sqrt(T(1 + i)));
+    const T zi = T(6) * z[i];
+    s += zi * zi;
+    p *= std::cos(zi / std::sqrt(T(1 + i)));
   }
   return 1 + s / T(4000) - p;
 }
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto ellips_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.ellips(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::ellips<simd_type<T>>(z.data(), N);
   T sum(0);
   for (int i = 0; i < N; i++) {
     sum += std::pow(T(10), T(6 * i) / T(N - 1)) * z[i] * z[i];
   }
   return sum;
 }
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto discus_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.discus(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::discus<simd_type<T>>(z.data(), N);
   T sum(1000000 * z[0] * z[0]);
   for (int i = 1; i < N; i++) {
     sum += z[i] * z[i];
@@ -259,43 +399,47 @@ inline auto bi_rastrigin_func(std::span<const T> z, std::span<const T> o,
                               std::span<const T> m) noexcept {
   constexpr T mu0(2.5);
   constexpr T d(1);
-  T s = T(1) - T(1) / (T(2) * std::sqrt(T(N + 20)) - T(8.2));
+  const int n = dim_of<N>(z);
+  T s = T(1) - T(1) / (T(2) * std::sqrt(T(n + 20)) - T(8.2));
   T mu1 = -std::sqrt((mu0 * mu0 - d) / s);
-  std::array<T, N> tmp;
-  std::array<T, N> y;
-  for (int i = 0; i < N; i++)
+  dim_array<T, N> tmp(n);
+  dim_array<T, N> y(n);
+  for (int i = 0; i < n; i++)
     tmp[i] = T(0.2) * T(o[i] > 0 ? 1 : -1) * (z[i] - o[i]) + mu0;
   T sum1(0);
-  T sum2(N);
-  for (int i = 0; i < N; i++) {
+  T sum2(n);
+  for (int i = 0; i < n; i++) {
     sum1 += (tmp[i] - mu0) * (tmp[i] - mu0);
     sum2 += s * (tmp[i] - mu1) * (tmp[i] - mu1);
     tmp[i] -= mu0;
   }
-  for (int i = 0; i < N; i++)
+  for (int i = 0; i < n; i++)
     y[i] =
-        std::inner_product(tmp.data(), tmp.data() + N, m.data() + i * N, T(0));
-  T sum3(N);
-  for (int i = 0; i < N; i++)
+        std::inner_product(tmp.data(), tmp.data() + n, m.data() + i * n, T(0));
+  T sum3(n);
+  for (int i = 0; i < n; i++)
     sum3 -= std::cos(2 * std::numbers::pi_v<T> * y[i]);
   return std::min(sum1, sum2) + 10 * sum3;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto bi_rastrigin_func(std::span<T, M> tmp) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? tmp.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.bi_rastrigin(tmp.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::bi_rastrigin<simd_type<T>>(tmp.data(), N);
   constexpr T mu0(2.5);
   constexpr T d(1);
   const T s = T(1) - T(1) / (T(2) * std::sqrt(T(N + 20)) - T(8.2));
   const T mu1 = -std::sqrt((mu0 * mu0 - d) / s);
-  for (int i = 0; i < N; i++)
-    tmp[i] += mu0;
   T sum1(0);
   T sum2(N);
   for (int i = 0; i < N; i++) {
-    sum1 += (tmp[i] - mu0) * (tmp[i] - mu0);
-    sum2 += s * (tmp[i] - mu1) * (tmp[i] - mu1);
-    tmp[i] -= mu0;
+    sum1 += tmp[i] * tmp[i];
+    sum2 += s * (tmp[i] + mu0 - mu1) * (tmp[i] + mu0 - mu1);
   }
   T sum3(N);
   for (int i = 0; i < N; i++)
@@ -303,9 +447,15 @@ inline auto bi_rastrigin_func(std::span<T, M> tmp) noexcept {
   return std::min(sum1, sum2) + 10 * sum3;
 }
 
-template <std::floating_point T, std::size_t M = std::dynamic_extent>
+template <std::floating_point T, std::size_t M = std::dynamic_extent,
+          bool Dispatch = true>
 inline auto weierstrass_func(std::span<T, M> z) noexcept {
   const auto N = static_cast<int>((M == std::dynamic_extent) ? z.size() : M);
+  if constexpr (Dispatch)
+    if (auto k = dispatched_kernels<T>())
+      return k->cec.weierstrass(z.data(), N);
+  if constexpr (simd::enabled<T>)
+    return simd::weierstrass<simd_type<T>>(z.data(), N);
   constexpr T a[] = {T(1) / T(1),      T(1) / T(2),      T(1) / T(4),
                      T(1) / T(8),      T(1) / T(16),     T(1) / T(32),
                      T(1) / T(64),     T(1) / T(128),    T(1) / T(256),
@@ -0,0 +1,380 @@
+#pragma once
+#include "../large_scale/simd_kernels.hpp"
+
+// Kernels are templated on the vector type V so that problem/dispatch can
+// compile them for several instruction sets, see large_scale/simd_kernels.hpp.
+namespace sevobench::problem::cec_detail::simd {
+
+template <typename T>
+inline constexpr bool enabled =
+    std::is_floating_point_v<T> && !std::is_same_v<T, long double> &&
+    (simd_id() >= 0);
+
+using problem::simd::kernels::for_blocks;
+using problem::simd::kernels::horizontal_mul;
+using problem::simd::kernels::lane_index;
+using problem::simd::kernels::load;
+using problem::simd::kernels::scalar_t;
+
+template <typename V>
+inline auto sum_sq(const scalar_t<V> *x, int n) noexcept {
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto t = load<V>(x + i, k);
+    v += t * t;
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto zakharov(const scalar_t<V> *y, int n) noexcept {
+  using T = scalar_t<V>;
+  V s1(0), s2(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto t = load<V>(y + i, k);
+    s1 += t * t;
+    s2 += T(0.5) * (lane_index<V>() + T(i + 1)) * t;
+  });
+  auto sum2 = horizontal_add(s2);
+  auto sq = sum2 * sum2;
+  return horizontal_add(s1) + sq + sq * sq;
+}
+
+template <typename V>
+inline auto sum_diff_pow(const scalar_t<V> *y, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    v = if_add(m, v, pow(abs(load<V>(y + i, k)), lane_index<V>() + T(i + 1)));
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto rosenbrock(const scalar_t<V> *t, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto) {
+    auto a = load<V>(t + i, k) * T(0.02048);
+    auto b = load<V>(t + i + 1, k) * T(0.02048);
+    v += square(a) + 100 * square(b + 1 - square(a + 1));
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto escaffer6(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  auto term = [](auto a, auto b) {
+    auto r = a * a + b * b;
+    auto s = sin(sqrt(r));
+    auto d = T(1) + T(0.001) * r;
+    return T(0.5) + (s * s - T(0.5)) / (d * d);
+  };
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto m) {
+    v = if_add(m, v, term(load<V>(z + i, k), load<V>(z + i + 1, k)));
+  });
+  auto tail = term(V(z[n - 1]), V(z[0]));
+  return horizontal_add(v) + tail[0];
+}
+
+template <typename V>
+inline auto rastrigin(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto t = load<V>(x + i, k) * T(0.0512);
+    v = if_add(m, v, t * t - 10 * cospi(2 * t));
+  });
+  return 10 * n + horizontal_add(v);
+}
+
+template <typename V>
+inline auto levy(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  constexpr auto pi = std::numbers::pi_v<T>;
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto) {
+    auto w = T(0.25) * load<V>(x + i, k);
+    v += w * w * (1 + 10 * square(sin(pi * (w + 1) + 1)));
+  });
+  auto w = 1 + T(0.25) * x[n - 1];
+  auto head = std::sin(pi * (1 + T(0.25) * x[0]));
+  auto tail = std::sin(2 * pi * w);
+  return head * head + horizontal_add(v) +
+         (w - 1) * (w - 1) * (1 + tail * tail);
+}
+
+template <typename V>
+inline auto bent_cigar(const scalar_t<V> *x, int n) noexcept {
+  return x[0] * x[0] + 1000000 * sum_sq<V>(x + 1, n - 1);
+}
+
+template <typename V>
+inline auto discus(const scalar_t<V> *x, int n) noexcept {
+  return 1000000 * x[0] * x[0] + sum_sq<V>(x + 1, n - 1);
+}
+
+template <typename V>
+inline auto ellips(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto e = 6 * (lane_index<V>() + T(i)) / T(n - 1);
+    v += square(load<V>(z + i, k)) * pow(V(10), e);
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto hg_sums(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  V s1(0), s2(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto z = load<V>(x + i, k) * T(0.05) - 1;
+    s1 = if_add(m, s1, z * z);
+    s2 = if_add(m, s2, z);
+  });
+  struct {
+    T sum1, sum2;
+  } r{horizontal_add(s1), horizontal_add(s2)};
+  return r;
+}
+
+template <typename V>
+inline auto hgbat(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  auto [sum1, sum2] = hg_sums<V>(x, n);
+  return std::sqrt(std::abs(sum1 * sum1 - sum2 * sum2)) +
+         (T(0.5) * sum1 + sum2) / n + T(0.5);
+}
+
+template <typename V>
+inline auto happycat(const scalar_t<V> *y, int n) noexcept {
+  using T = scalar_t<V>;
+  auto [sum1, sum2] = hg_sums<V>(y, n);
+  return std::pow(std::abs(sum1 - n), T(0.25)) + (T(0.5) * sum1 + sum2) / n +
+         T(0.5);
+}
+
+template <typename V>
+inline auto katsuura(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  const T e = T(10) / std::pow(T(n), T(1.2));
+  V p(1);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto x = load<V>(z + i, k) * T(0.05);
+    V temp(0);
+    T b = 1;
+    for (int j = 1; j <= 32; j++) {
+      b *= 2;
+      auto t = b * x;
+      temp += abs(t - floor(t + T(0.5))) * (1 / b);
+    }
+    p *= pow(1 + (lane_index<V>() + T(i + 1)) * temp, e);
+  });
+  T tmp1 = T(10) / T(n * n);
+  return horizontal_mul(p) * tmp1 - tmp1;
+}
+
+template <typename V>
+inline auto ackley(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  V sum(0), sqsum(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto t = load<V>(x + i, k);
+    sum = if_add(m, sum, cospi(2 * t));
+    sqsum += t * t;
+  });
+  return 20 + std::numbers::e_v<T> - std::exp(horizontal_add(sum) / n) -
+         20 * std::exp(T(-0.2) * std::sqrt(horizontal_add(sqsum) / n));
+}
+
+template <typename V>
+inline auto schwefel(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto x = load<V>(z + i, k) * T(10) + T(420.9687462275036);
+    auto r = abs(x) - T(500) * truncate(abs(x) / T(500));
+    auto sr = sin(sqrt(abs(T(500) - r)));
+    auto hi = (T(500) - r) * sr;
+    auto lo = (T(-500) + r) * sr;
+    auto edge = select(x > 0, V(500), V(-500));
+    auto out = square((x - edge) / T(100)) / T(n);
+    auto f = select(x > T(500), out - hi,
+                    select(x < T(-500), out - lo, -x * sin(sqrt(abs(x)))));
+    v = if_add(m, v, f);
+  });
+  return horizontal_add(v) + T(418.9828872724338) * n;
+}
+
+template <typename V>
+inline auto schwefel_F7(const scalar_t<V> *y, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto) {
+    auto a = load<V>(y + i, k);
+    auto b = load<V>(y + i + 1, k);
+    auto x = sqrt(a * a + b * b);
+    v += sqrt(x) * (1 + square(sin(T(50) * pow(x, T(0.2)))));
+  });
+  auto sum = horizontal_add(v);
+  return sum * sum / T((n - 1) * (n - 1));
+}
+
+template <typename V>
+inline auto grie_rosen(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  auto term = [](auto a, auto b) {
+    auto temp = T(100) * square(a * a - b) + square(a - 1);
+    return temp * temp / T(4000) - cos(temp) + T(1);
+  };
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto m) {
+    v = if_add(m, v,
+               term(load<V>(z + i, k) * T(0.05) + 1,
+                    load<V>(z + i + 1, k) * T(0.05) + 1));
+  });
+  auto tail = term(V(z[n - 1] * T(0.05) + 1),
+                   V(z[0] * T(0.05) + 1));
+  return horizontal_add(v) + tail[0];
+}
+
+template <typename V>
+inline auto griewank(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  V s(0), p(1);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto t = load<V>(z + i, k) * T(6);
+    s += t * t;
+    p *= cos(t / sqrt(lane_index<V>() + T(i + 1)));
+  });
+  return 1 + horizontal_add(s) / T(4000) - horizontal_mul(p);
+}
+
+template <typename V>
+inline auto bi_rastrigin(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  constexpr T mu0(2.5);
+  constexpr T d(1);
+  const T s = T(1) - T(1) / (T(2) * std::sqrt(T(n + 20)) - T(8.2));
+  const T mu1 = -std::sqrt((mu0 * mu0 - d) / s);
+  V s1(0), s2(0), s3(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto t = load<V>(x + i, k);
+    s1 += t * t;
+    s2 = if_add(m, s2, square(t + mu0 - mu1));
+    s3 = if_add(m, s3, cospi(2 * t));
+  });
+  const T t1 = horizontal_add(s1);
+  const T t2 = n + s * horizontal_add(s2);
+  return (t2 < t1 ? t2 : t1) + 10 * (n - horizontal_add(s3));
+}
+
+template <typename V>
+inline auto weierstrass(const scalar_t<V> *z, int n) noexcept {
+  using T = scalar_t<V>;
+  constexpr int k_max = 20;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto x = T(0.5 / 100) * load<V>(z + i, k) + T(0.5);
+    V acc(0);
+    T a = 1;
+    T b = 1;
+    for (int j = 0; j <= k_max; j++) {
+      acc += a * cospi(2 * b * x);
+      a *= T(0.5);
+      b *= T(3);
+    }
+    v = if_add(m, v, acc);
+  });
+  constexpr T sum2 = T(-2097151) / T(1048576);
+  return horizontal_add(v) - n * sum2;
+}
+
+// Rows [r, r + R) of y[q] = rows * d[q] for P points: each loaded block of
+// a row is used for P points and each block of a point for R rows.
+template <typename V, int R, int P>
+inline void rotate_block(const scalar_t<V> *rows, int n, int r,
+                         const scalar_t<V> *const *d,
+                         scalar_t<V> *const *y) noexcept {
+  V a[R][P];
+  for (int i = 0; i < R; i++)
+    for (int q = 0; q < P; q++)
+      a[i][q] = V(0);
+  const auto *row0 = rows + r * n;
+  for_blocks<V>(n, [&](int j, int k, auto) {
+    V t[P];
+    for (int q = 0; q < P; q++)
+      t[q] = load<V>(d[q] + j, k);
+    for (int i = 0; i < R; i++) {
+      const auto row = load<V>(row0 + i * n + j, k);
+      for (int q = 0; q < P; q++)
+        a[i][q] = mul_add(row, t[q], a[i][q]);
+    }
+  });
+  for (int i = 0; i < R; i++)
+    for (int q = 0; q < P; q++)
+      y[q][r + i] = horizontal_add(a[i][q]);
+}
+
+template <typename V, int P>
+inline void rotate_points(const scalar_t<V> *rows, int n,
+                          const scalar_t<V> *const *d,
+                          scalar_t<V> *const *y) noexcept {
+  int r = 0;
+  for (; r + 4 <= n; r += 4)
+    rotate_block<V, 4, P>(rows, n, r, d, y);
+  for (; r < n; r++)
+    rotate_block<V, 1, P>(rows, n, r, d, y);
+}
+
+// Shift and rotation of all m components of a composition function for
+// several points in one pass over the stacked (m * n) x n rotation block.
+// Point p is x + p * stride; its output at y + p * (m * n + m) is its m
+// rotated differences to the shifts, followed by their m squared lengths.
+// diff holds the m * n differences of a point. Matrix blocks are loaded once
+// per four points and each block of a difference once per four rows.
+template <typename V>
+inline void composition_sr(const scalar_t<V> *x, int points, int stride,
+                           const scalar_t<V> *shift,
+                           const scalar_t<V> *rotate, int n, int m,
+                           scalar_t<V> *diff, scalar_t<V> *y) noexcept {
+  using T = scalar_t<V>;
+  const int out = m * n + m;
+  for (int p = 0; p < points; p++)
+    for (int c = 0; c < m; c++) {
+      auto *dp = diff + (p * m + c) * n;
+      V d2(0);
+      for_blocks<V>(n, [&](int i, int k, auto) {
+        auto t = load<V>(x + p * stride + i, k) - load<V>(shift + c * n + i, k);
+        t.store_partial(k, dp + i);
+        d2 = mul_add(t, t, d2);
+      });
+      y[p * out + m * n + c] = horizontal_add(d2);
+    }
+  constexpr int P = 4;
+  const T *dq[P];
+  T *yq[P];
+  for (int c = 0; c < m; c++) {
+    const auto *rows = rotate + std::size_t(c) * n * n;
+    auto at = [&](int p, int q) {
+      dq[q] = diff + (p * m + c) * n;
+      yq[q] = y + p * out + c * n;
+    };
+    int p = 0;
+    for (; p + P <= points; p += P) {
+      for (int q = 0; q < P; q++)
+        at(p + q, q);
+      rotate_points<V, P>(rows, n, dq, yq);
+    }
+    for (; p < points; p++) {
+      at(p, 0);
+      rotate_points<V, 1>(rows, n, dq, yq);
+    }
+  }
+}
+
+} // namespace sevobench::problem::cec_detail::simd
@@ -0,0 +1,292 @@
+#pragma once
+#include "../../common/tool.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sevobench::problem::cec_detail {
+
+inline constexpr char pack_magic[8] = {'S', 'E', 'V', 'O', 'C', 'E', 'C', '1'};
+inline constexpr std::uint32_t pack_version = 1;
+inline constexpr const char *pack_file_name = "cec_data.pack";
+
+enum class pack_type : std::uint32_t { f32 = 0, f64 = 1, i32 = 2 };
+
+struct pack_header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t entry_count;
+  std::uint64_t reserved[6];
+};
+
+struct pack_entry {
+  char name[40];
+  pack_type type;
+  std::uint32_t reserved;
+  std::uint64_t offset;
+  std::uint64_t count;
+};
+
+static_assert(sizeof(pack_header) == tool::cache_line_size);
+static_assert(sizeof(pack_entry) == tool::cache_line_size);
+
+template <typename U> constexpr auto pack_type_of() noexcept {
+  if constexpr (std::is_same_v<U, float>)
+    return pack_type::f32;
+  else if constexpr (std::is_same_v<U, double>)
+    return pack_type::f64;
+  else {
+    static_assert(std::is_same_v<U, int>, "UNSUPPORTED PACK TYPE");
+    return pack_type::i32;
+  }
+}
+
+class mapped_file {
+  const std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+#if defined(_WIN32)
+  tool::aligned_vector<std::byte> buffer_;
+#endif
+
+public:
+  explicit mapped_file(const std::string &path) noexcept {
+#if defined(_WIN32)
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs)
+      return;
+    buffer_.resize(static_cast<std::size_t>(ifs.tellg()));
+    ifs.seekg(0);
+    if (ifs.read(reinterpret_cast<char *>(buffer_.data()), buffer_.size())) {
+      data_ = buffer_.data();
+      size_ = buffer_.size();
+    }
+#else
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return;
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+      auto p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+                      MAP_SHARED, fd, 0);
+      if (p != MAP_FAILED) {
+        data_ = static_cast<const std::byte *>(p);
+        size_ = static_cast<std::size_t>(st.st_size);
+      }
+    }
+    ::close(fd);
+#endif
+  }
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+  ~mapped_file() {
+#if !defined(_WIN32)
+    if (data_)
+      ::munmap(const_cast<std::byte *>(data_), size_);
+#endif
+  }
+  auto data() const noexcept { return data_; }
+  auto size() const noexcept { return size_; }
+};
+
+class data_pack {
+  std::shared_ptr<const mapped_file> file_;
+  std::map<std::pair<std::string, pack_type>, const pack_entry *, std::less<>>
+      index_;
+
+  bool parse() noexcept {
+    const auto size = file_->size();
+    if (size < sizeof(pack_header))
+      return false;
+    const auto *h = reinterpret_cast<const pack_header *>(file_->data());
+    if (std::memcmp(h->magic, pack_magic, sizeof(pack_magic)) != 0 ||
+        h->version != pack_version ||
+        sizeof(pack_header) + h->entry_count * sizeof(pack_entry) > size)
+      return false;
+    const auto *e = reinterpret_cast<const pack_entry *>(h + 1);
+    for (std::uint32_t i = 0; i < h->entry_count; i++) {
+      const auto bytes = e[i].count * (e[i].type == pack_type::f64 ? 8 : 4);
+      if (e[i].offset % tool::cache_line_size != 0 || e[i].offset > size ||
+          bytes > size - e[i].offset)
+        return false;
+      std::string name(e[i].name,
+                       std::find(e[i].name, e[i].name + sizeof(e[i].name), '\0'));
+      index_.emplace(std::make_pair(std::move(name), e[i].type), e + i);
+    }
+    return true;
+  }
+
+public:
+  explicit data_pack(const std::string &path)
+      : file_(std::make_shared<const mapped_file>(path)) {}
+
+  static auto open(const std::string &dir_name) {
+    static std::mutex mut;
+    static std::map<std::string, std::weak_ptr<const data_pack>> cache;
+    const auto path =
+        (std::filesystem::path(dir_name) / pack_file_name).lexically_normal();
+    std::lock_guard<std::mutex> lck(mut);
+    auto &slot = cache[path.string()];
+    auto pack = slot.lock();
+    if (!pack) {
+      std::error_code ec;
+      if (!std::filesystem::is_regular_file(path, ec))
+        return std::shared_ptr<const data_pack>();
+      auto p = std::make_shared<data_pack>(path.string());
+      if (!p->parse())
+        return std::shared_ptr<const data_pack>();
+      pack = std::move(p);
+      slot = pack;
+    }
+    return pack;
+  }
+
+  template <typename U>
+  std::optional<tool::shared_array<U>> find(const std::string &name) const {
+    auto it = index_.find(std::make_pair(name, pack_type_of<U>()));
+    if (it == index_.end())
+      return std::nullopt;
+    const auto *e = it->second;
+    const auto *p = reinterpret_cast<const U *>(file_->data() + e->offset);
+    return tool::shared_array<U>(
+        std::span<const U>(p, static_cast<std::size_t>(e->count)), file_);
+  }
+};
+
+namespace pack_detail {
+struct table {
+  std::string name;
+  pack_type type;
+  std::vector<std::byte> bytes;
+  std::uint64_t count;
+};
+
+template <typename U>
+inline auto make_table(std::string name, const std::vector<U> &v) {
+  table t{std::move(name), pack_type_of<U>(),
+          std::vector<std::byte>(v.size() * sizeof(U)), v.size()};
+  std::memcpy(t.bytes.data(), v.data(), t.bytes.size());
+  return t;
+}
+
+inline auto read_rows(const std::filesystem::path &file) {
+  std::vector<std::vector<double>> rows;
+  std::ifstream ifs(file);
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    std::vector<double> row;
+    double tmp;
+    while (iss >> tmp)
+      row.push_back(tmp);
+    if (!row.empty())
+      rows.push_back(std::move(row));
+  }
+  return rows;
+}
+
+inline auto add_real_table(std::vector<table> &tables, const std::string &name,
+                           const std::vector<double> &v) {
+  tables.push_back(make_table(name, v));
+  tables.push_back(make_table(name, std::vector<float>(v.begin(), v.end())));
+}
+} // namespace pack_detail
+
+// Packs the M_*, shift_data_* and shuffle_data_* text files of a CEC data
+// directory into cec_data.pack. Real tables are stored in both precisions,
+// shift rows are truncated per dimension and shuffles are stored 0-based.
+inline bool pack_cec_data(const std::string &dir_name) {
+  namespace fs = std::filesystem;
+  using namespace pack_detail;
+  std::error_code ec;
+  std::vector<fs::path> files;
+  for (const auto &e : fs::directory_iterator(dir_name, ec))
+    if (e.is_regular_file() && e.path().extension() == ".txt")
+      files.push_back(e.path());
+  if (ec)
+    return false;
+  std::sort(files.begin(), files.end());
+  std::set<int> dims;
+  for (const auto &f : files) {
+    auto stem = f.stem().string();
+    if (stem.starts_with("M_"))
+      dims.insert(std::stoi(stem.substr(stem.rfind("_D") + 2)));
+  }
+  std::vector<table> tables;
+  for (const auto &f : files) {
+    auto stem = f.stem().string();
+    if (stem.starts_with("M_")) {
+      std::vector<double> v;
+      for (auto &row : read_rows(f))
+        v.insert(v.end(), row.begin(), row.end());
+      add_real_table(tables, stem, v);
+    } else if (stem.starts_with("shift_data_")) {
+      auto rows = read_rows(f);
+      for (auto d : dims) {
+        std::vector<double> v;
+        for (auto &row : rows) {
+          if (static_cast<int>(row.size()) < d)
+            break;
+          v.insert(v.end(), row.begin(), row.begin() + d);
+        }
+        if (!v.empty())
+          add_real_table(tables, stem + "_D" + std::to_string(d), v);
+      }
+    } else if (stem.starts_with("shuffle_data_")) {
+      std::vector<int> v;
+      for (auto &row : read_rows(f))
+        for (auto x : row)
+          v.push_back(static_cast<int>(x) - 1);
+      tables.push_back(make_table(stem, v));
+    }
+  }
+  pack_header h{};
+  std::memcpy(h.magic, pack_magic, sizeof(pack_magic));
+  h.version = pack_version;
+  h.entry_count = static_cast<std::uint32_t>(tables.size());
+  std::vector<pack_entry> entries(tables.size());
+  std::uint64_t offset = sizeof(pack_header) + tables.size() * sizeof(pack_entry);
+  const auto align = [](std::uint64_t n) {
+    return (n + tool::cache_line_size - 1) / tool::cache_line_size *
+           tool::cache_line_size;
+  };
+  for (std::size_t i = 0; i < tables.size(); i++) {
+    if (tables[i].name.size() >= sizeof(pack_entry::name))
+      return false;
+    std::memcpy(entries[i].name, tables[i].name.data(), tables[i].name.size());
+    entries[i].type = tables[i].type;
+    entries[i].offset = offset = align(offset);
+    entries[i].count = tables[i].count;
+    offset += tables[i].bytes.size();
+  }
+  auto tmp = fs::path(dir_name) / (std::string(pack_file_name) + ".tmp");
+  {
+    std::ofstream ofs(tmp, std::ios::binary | std::ios::trunc);
+    ofs.write(reinterpret_cast<const char *>(&h), sizeof(h));
+    ofs.write(reinterpret_cast<const char *>(entries.data()),
+              entries.size() * sizeof(pack_entry));
+    for (std::size_t i = 0; i < tables.size(); i++) {
+      while (static_cast<std::uint64_t>(ofs.tellp()) < entries[i].offset)
+        ofs.put('\0');
+      ofs.write(reinterpret_cast<const char *>(tables[i].bytes.data()),
+                tables[i].bytes.size());
+    }
+    if (!ofs)
+      return false;
+  }
+  fs::rename(tmp, fs::path(dir_name) / pack_file_name, ec);
+  return !ec;
+}
+
+} // namespace sevobench::problem::cec_detail
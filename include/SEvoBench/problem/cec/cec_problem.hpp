@@ -2,37 +2,69 @@
 #include "../../common/tool.hpp"
 #include "../problem.hpp"
 #include "cec_base_problem.hpp"
+#include "cec_data.hpp"
 #include <fstream>
 #include <sstream>
 namespace sevobench::problem {
 
 namespace cec_detail {
 
-template <std::size_t N, bool only_shift = false, std::floating_point T>
-inline void sr_func(std::span<const T> x, std::span<T, N> y,
+template <int N, bool only_shift = false, std::floating_point T>
+inline void sr_func(std::span<const T> x, dim_span<T, N> y,
                     std::span<const T> o, std::span<const T> m) noexcept {
+  const int n = dim_of<N>(y);
   if constexpr (only_shift) {
-    for (std::size_t i = 0; i < N; i++)
+    for (int i = 0; i < n; i++)
       y[i] = x[i] - o[i];
   } else {
-    std::array<T, N> tmp;
-    for (std::size_t i = 0; i < N; i++)
+    dim_array<T, N> tmp(n);
+    for (int i = 0; i < n; i++)
       tmp[i] = x[i] - o[i];
-    for (std::size_t i = 0; i < N; i++)
-      y[i] = std::inner_product(tmp.data(), tmp.data() + N, m.data() + i * N,
+    for (int i = 0; i < n; i++)
+      y[i] = std::inner_product(tmp.data(), tmp.data() + n, m.data() + i * n,
                                 T(0));
   }
 }
 
-template <int N, int Num, std::floating_point T>
-inline auto cf_cal(std::span<const T> x, std::span<const T> o,
-                   std::span<const T, Num> fit,
-                   std::span<const T, Num> delta) noexcept {
-  std::array<T, Num> w{};
-  for (int i = 0; i < Num; i++) {
-    for (int j = 0; j < N; j++)
-      w[i] += tool::Pow<2>(x[j] - o[i * N + j]);
+inline constexpr int batch_block = 8;
+
+template <std::size_t N, bool only_shift = false, std::floating_point T>
+inline void sr_batch_func(std::span<const T> X, int n, std::size_t stride,
+                          std::span<T> Y, std::span<const T> o,
+                          std::span<const T> m) noexcept {
+  if constexpr (only_shift) {
+    for (int r = 0; r < n; r++)
+      for (std::size_t i = 0; i < N; i++)
+        Y[r * N + i] = X[r * stride + i] - o[i];
+  } else {
+    constexpr int B = batch_block;
+    alignas(tool::cache_line_size) std::array<T, N * B> tmp;
+    for (int r0 = 0; r0 < n; r0 += B) {
+      const int nb = std::min(B, n - r0);
+      for (std::size_t j = 0; j < N; j++) {
+        for (int b = 0; b < nb; b++)
+          tmp[j * B + b] = X[(r0 + b) * stride + j] - o[j];
+        for (int b = nb; b < B; b++)
+          tmp[j * B + b] = T(0);
+      }
+      for (std::size_t i = 0; i < N; i++) {
+        const auto *mi = m.data() + i * N;
+        std::array<T, B> acc{};
+        for (std::size_t j = 0; j < N; j++)
+          for (int b = 0; b < B; b++)
+            acc[b] += mi[j] * tmp[j * B + b];
+        for (int b = 0; b < nb; b++)
+          Y[(r0 + b) * N + i] = acc[b];
+      }
+    }
   }
+}
+
+// Weighted sum of the component values given the squared distances w of x
+// to each component's shift.
+template <int Num, std::floating_point T>
+inline auto cf_weight(std::array<T, Num> w, std::span<const T, Num> fit,
+                      std::span<const T, Num> delta, int N) noexcept {
   auto it = std::find(w.begin(), w.end(), T(0));
   if (it != w.end()) {
     return fit[it - w.begin()];
@@ -43,52 +75,243 @@ inline auto cf_cal(std::span<const T> x, std::span<const T> o,
   return std::inner_product(w.begin(), w.end(), fit.begin(), T(0)) / w_sum;
 }
 
-template <int Dim, typename T>
-inline auto read_cec_data(const std::string &file_name) noexcept {
-  std::vector<T> result(Dim);
+template <int N, int Num, std::floating_point T>
+inline auto cf_cal(std::span<const T> x, std::span<const T> o,
+                   std::span<const T, Num> fit,
+                   std::span<const T, Num> delta) noexcept {
+  const int n = dim_of<N>(x);
+  std::array<T, Num> w{};
+  for (int i = 0; i < Num; i++) {
+    for (int j = 0; j < n; j++)
+      w[i] += tool::Pow<2>(x[j] - o[i * n + j]);
+  }
+  return cf_weight<Num, T>(w, fit, delta, n);
+}
+
+template <typename T>
+inline auto read_cec_data(const std::string &file_name, int size) noexcept {
+  tool::aligned_vector<T> result(size);
   std::ifstream is(file_name);
-  for (int i = 0; i < Dim; i++) {
+  for (int i = 0; i < size; i++) {
     is >> result[i];
   }
   return result;
 }
 
-template <int Dim, std::floating_point T, std::size_t M, typename F>
-  requires(Dim > 0) && (Dim % 10 == 0)
-inline auto calculate_hybrid(std::span<T, Dim> y,
-                             const std::array<std::pair<int, int>, M> &ratios,
-                             const std::array<F, M> &functions) noexcept {
-  T sum(0);
-  int offset = 0;
-  for (std::size_t i = 0; i < M; i++) {
-    auto [u, v] = ratios[i];
-    auto dim = (u * Dim) / v;
-    sum += functions[i](y.subspan(offset, dim));
-    offset += dim;
-  }
-  return sum;
+// The basic functions as types, so that a hybrid_part can call them on a
+// segment whose length is part of its type. They bypass the kernel registry,
+// so each segment runs the compile-time kernel at its constant length.
+namespace basic {
+struct ackley {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return ackley_func<T, M, false>(y);
+  }
+};
+struct bent_cigar {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return bent_cigar_func<T, M, false>(y);
+  }
+};
+struct bi_rastrigin {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return bi_rastrigin_func<T, M, false>(y);
+  }
+};
+struct discus {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return discus_func<T, M, false>(y);
+  }
+};
+struct ellips {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return ellips_func<T, M, false>(y);
+  }
+};
+struct escaffer6 {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return escaffer6_func<T, M, false>(y);
+  }
+};
+struct grie_rosen {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return grie_rosen_func<T, M, false>(y);
+  }
+};
+struct griewank {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return griewank_func<T, M, false>(y);
+  }
+};
+struct happycat {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return happycat_func<T, M, false>(y);
+  }
+};
+struct hgbat {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return hgbat_func<T, M, false>(y);
+  }
+};
+struct katsuura {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return katsuura_func<T, M, false>(y);
+  }
+};
+struct rastrigin {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return rastrigin_func<T, M, false>(y);
+  }
+};
+struct rosenbrock {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return rosenbrock_func<T, M, false>(y);
+  }
+};
+struct schwefel {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return schwefel_func<T, M, false>(y);
+  }
+};
+struct schwefel_F7 {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return schwefel_F7_func<T, M, false>(y);
+  }
+};
+struct weierstrass {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return weierstrass_func<T, M, false>(y);
+  }
+};
+struct zakharov {
+  template <typename T, std::size_t M>
+  auto operator()(std::span<T, M> y) const noexcept {
+    return zakharov_func<T, M, false>(y);
+  }
+};
+} // namespace basic
+
+// A segment of u / v of the dimensions, evaluated with F.
+template <int U, int V, typename F> struct hybrid_part {
+  static constexpr int size(int dim) { return U * dim / V; }
+  using function = F;
+};
+
+// Sum of Parts over consecutive segments of y. Offsets and lengths are
+// constants, so every part gets a fixed-extent span and is inlined. With
+// runtime_dim they are computed from y, the last part taking the rest.
+template <int Dim, std::floating_point T, typename... Parts>
+  requires(Dim == runtime_dim) || (Dim > 0 && Dim % 10 == 0)
+inline auto calculate_hybrid(dim_span<T, Dim> y) noexcept {
+  if constexpr (Dim == runtime_dim) {
+    const int n = static_cast<int>(y.size());
+    int offset = 0, left = sizeof...(Parts);
+    T sum(0);
+    (
+        [&](int size) {
+          size = --left == 0 ? n - offset : size;
+          sum += typename Parts::function{}(y.subspan(offset, size));
+          offset += size;
+        }(Parts::size(n)),
+        ...);
+    return sum;
+  } else {
+    constexpr std::array<int, sizeof...(Parts)> sizes{Parts::size(Dim)...};
+    constexpr auto offsets = [] {
+      std::array<int, sizeof...(Parts)> o{}, n{Parts::size(Dim)...};
+      for (std::size_t i = 1; i < o.size(); i++)
+        o[i] = o[i - 1] + n[i - 1];
+      return o;
+    }();
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return (T(0) + ... +
+              (typename Parts::function{}(
+                  y.template subspan<offsets[I], sizes[I]>())));
+    }(std::index_sequence_for<Parts...>());
+  }
 }
 
+// The components of a composition function: functions[i] scaled by lams[i]
+// and offset by biases[i], weighted by the distance to the i-th shift
+// relative to deltas[i]. With b, the input of functions[i] is permuted by
+// the i-th shuffle block.
+template <int Dim, bool b, std::floating_point T, std::size_t M, typename G>
+struct cf_components {
+  std::array<T, M> deltas;
+  std::array<T, M> lams;
+  std::array<T, M> biases;
+  std::array<G, M> functions;
+};
+
 template <int Dim, bool b = false, std::floating_point T, std::size_t M,
           typename G>
-inline auto calculate_composition(
-    std::span<const T> x, const std::array<T, M> &deltas,
-    const std::array<T, M> &lams, const std::array<T, M> &biases,
-    const std::array<G, M> &functions, std::span<const T> shift,
-    std::span<const T> rotate, std::span<const int> shuffle) noexcept {
+constexpr auto make_components(const std::array<T, M> &deltas,
+                               const std::array<T, M> &lams,
+                               const std::array<T, M> &biases,
+                               const std::array<G, M> &functions) noexcept {
+  return cf_components<Dim, b, T, M, G>{deltas, lams, biases, functions};
+}
+
+template <int Dim, bool b, std::floating_point T, std::size_t M, typename G>
+inline auto calculate_composition(std::span<const T> x,
+                                  const cf_components<Dim, b, T, M, G> &c,
+                                  std::span<const T> shift,
+                                  std::span<const T> rotate,
+                                  std::span<const int> shuffle) noexcept {
+  const int n = dim_of<Dim>(x);
   std::array<T, M> fits;
+  dim_array<T, Dim> y(n);
+  for (size_t i = 0; i < M; i++) {
+    sr_func<Dim, false, T>(x, y, shift.subspan(i * n),
+                           rotate.subspan(i * n * n));
+    if constexpr (b) {
+      dim_array<T, Dim> z(n);
+      std::copy_n(y.begin(), n, z.begin());
+      for (int j = 0; j < n; j++)
+        y[j] = z[shuffle[i * n + j]];
+    }
+    fits[i] = c.lams[i] * c.functions[i](y) + c.biases[i];
+  }
+  return cf_cal<Dim, M, T>(x, shift, fits, c.deltas);
+}
+
+// The same from one point's output of simd::composition_sr: the M rotated
+// differences, then their M squared lengths (see cec_common::evaluate_batch).
+template <int Dim, bool b, std::floating_point T, std::size_t M, typename G>
+  requires(Dim != runtime_dim)
+inline auto calculate_composition_fused(
+    std::span<const T, M * Dim + M> y_and_w,
+    const cf_components<Dim, b, T, M, G> &c,
+    std::span<const int> shuffle) noexcept {
+  std::array<T, M> fits, w;
   std::array<T, Dim> y;
   for (size_t i = 0; i < M; i++) {
-    sr_func<Dim, false, T>(x, y, shift.subspan(i * Dim),
-                           rotate.subspan(i * Dim * Dim));
+    const auto *yi = y_and_w.data() + i * Dim;
     if constexpr (b) {
-      std::array<T, Dim> z = y;
       for (int j = 0; j < Dim; j++)
-        y[j] = z[shuffle[i * Dim + j]];
+        y[j] = yi[shuffle[i * Dim + j]];
+    } else {
+      std::copy_n(yi, Dim, y.begin());
     }
-    fits[i] = lams[i] * functions[i](y) + biases[i];
+    fits[i] = c.lams[i] * c.functions[i](y) + c.biases[i];
+    w[i] = y_and_w[M * Dim + i];
   }
-  return cf_cal<Dim, M, T>(x, shift, fits, deltas);
+  return cf_weight<M, T>(w, fits, c.deltas, Dim);
 }
 } // namespace cec_detail
 
@@ -96,117 +319,161 @@ template <int Index, int Dim, std::floating_point T,
           template <int, int, typename> class Drived>
 class cec_common : public problem_common<Index, Dim, T> {
 protected:
-  std::vector<T> shift;
-  std::vector<T> matrix;
-  std::vector<int> shuffle;
+  tool::shared_array<T> shift;
+  tool::shared_array<T> matrix;
+  tool::shared_array<int> shuffle;
   int ins = 0;
+  static constexpr auto table_num() {
+    if constexpr (is_composition_problem())
+      return Drived<Index, Dim, T>::cf_num();
+    else
+      return 1;
+  }
+  static constexpr auto has_shuffle() {
+    return is_hybrid_problem() || (requires {
+             requires Drived<Index, Dim, T>::is_hybrid_composition();
+           });
+  }
+  void set_dim(int d) noexcept {
+    if constexpr (Dim == runtime_dim)
+      this->dim_ = d;
+  }
   void load_rotate_matrix(const std::string &dir_name, int idx) {
+    const int d = this->dim();
     std::ostringstream os;
-    os << dir_name << '/' << "M_" << idx << "_D" << Dim << ".txt";
-    if constexpr (is_composition_problem()) {
-      matrix =
-          cec_detail::read_cec_data<Dim * Dim * Drived<Index, Dim, T>::cf_num(),
-                                    T>(os.str());
-    } else {
-      matrix = cec_detail::read_cec_data<Dim * Dim, T>(os.str());
-    }
+    os << dir_name << '/' << "M_" << idx << "_D" << d << ".txt";
+    matrix = cec_detail::read_cec_data<T>(os.str(), d * d * table_num());
   }
   void load_shift_shuffle(const std::string &dir_name, int idx) {
+    const int d = this->dim();
     {
       std::ostringstream os;
       os << dir_name << '/' << "shift_data_" << idx << ".txt";
       if constexpr (is_composition_problem()) {
-        shift.reserve(Dim * Drived<Index, Dim, T>::cf_num());
+        tool::aligned_vector<T> v;
+        v.reserve(d * table_num());
         std::ifstream ifs(os.str());
         std::string line;
-        for (int _ = 0; _ < Drived<Index, Dim, T>::cf_num(); _++) {
+        for (int _ = 0; _ < table_num(); _++) {
           std::getline(ifs, line);
           std::istringstream iss(line);
-          for (int i = 0; i < Dim; i++) {
+          for (int i = 0; i < d; i++) {
             T tmp;
             iss >> tmp;
-            shift.push_back(tmp);
+            v.push_back(tmp);
           }
         }
+        shift = std::move(v);
       } else {
-        shift = cec_detail::read_cec_data<Dim, T>(os.str());
+        shift = cec_detail::read_cec_data<T>(os.str(), d);
       }
     }
-    if constexpr (is_hybrid_problem() || (requires {
-                    requires Drived<Index, Dim, T>::is_hybrid_composition();
-                  })) {
-      constexpr auto num = [] {
-        if constexpr (is_composition_problem())
-          return Drived<Index, Dim, T>::cf_num();
-        else
-          return 1;
-      }();
+    if constexpr (has_shuffle()) {
       std::ostringstream os;
-      os << dir_name << '/' << "shuffle_data_" << idx << "_D" << Dim << ".txt";
-      shuffle = cec_detail::read_cec_data<num * Dim, int>(os.str());
-      for (auto &x : shuffle)
+      os << dir_name << '/' << "shuffle_data_" << idx << "_D" << d << ".txt";
+      auto v = cec_detail::read_cec_data<int>(os.str(), table_num() * d);
+      for (auto &x : v)
         --x;
+      shuffle = std::move(v);
+    }
+  }
+  bool load_pack(const cec_detail::data_pack &pack, int idx) {
+    const auto d = static_cast<std::size_t>(this->dim());
+    const auto suffix = std::to_string(idx) + "_D" + std::to_string(d);
+    auto s = pack.find<T>("shift_data_" + suffix);
+    auto m = pack.find<T>("M_" + suffix);
+    if (!s || !m || s->size() < d * table_num() ||
+        m->size() < d * d * table_num())
+      return false;
+    if constexpr (has_shuffle()) {
+      auto u = pack.find<int>("shuffle_data_" + suffix);
+      if (!u || u->size() < d * table_num())
+        return false;
+      shuffle = std::move(*u);
     }
+    shift = std::move(*s);
+    matrix = std::move(*m);
+    return true;
   }
-  cec_common(const std::string &dir_name, int idx) {
-    load_shift_shuffle(dir_name, idx);
-    load_rotate_matrix(dir_name, idx);
+  void load(const std::string &dir_name, int idx) {
+    auto pack = cec_detail::data_pack::open(dir_name);
+    if (!pack || !load_pack(*pack, idx)) {
+      load_shift_shuffle(dir_name, idx);
+      load_rotate_matrix(dir_name, idx);
+    }
     ins = 1;
   }
-
-public:
-  cec_common() = default;
-  cec_common(cec_common &&) = default;
-  cec_common(const cec_common &) = default;
-  cec_common &operator=(cec_common &&) = default;
-  cec_common &operator=(const cec_common &) = default;
-  cec_common(int _ins) : ins(_ins) {
-    std::default_random_engine gen(std::random_device{}());
+  void generate() {
+    const int d = this->dim();
+    std::default_random_engine gen(tool::seed_source{}());
     std::uniform_real_distribution<T> o1(lower_bound(), upper_bound());
-    constexpr auto num = [] {
-      if constexpr (is_composition_problem())
-        return Drived<Index, Dim, T>::cf_num();
-      else
-        return 1;
-    }();
-    shift.resize(num * Dim);
-    std::generate_n(shift.begin(), num * Dim, [&] { return o1(gen); });
+    constexpr auto num = table_num();
+    tool::aligned_vector<T> s(num * d);
+    std::generate_n(s.begin(), num * d, [&] { return o1(gen); });
+    shift = std::move(s);
     if constexpr (!is_only_shift()) {
-      matrix.resize(Dim * Dim * num);
+      tool::aligned_vector<T> m(d * d * num);
       for (int i = 0; i < num; i++) {
-        tool::generate_rotate_vector<Dim, T>(
-            std::span<T>(matrix.data() + i * Dim * Dim, Dim * Dim));
+        tool::generate_rotate_vector<T>(
+            std::span<T>(m.data() + i * d * d, d * d), d);
       }
+      matrix = std::move(m);
     }
-    if constexpr (is_hybrid_problem() || (requires {
-                    requires Drived<Index, Dim, T>::is_hybrid_composition();
-                  })) {
-      shuffle.resize(num * Dim);
-      std::default_random_engine gen1(std::random_device{}());
+    if constexpr (has_shuffle()) {
+      tool::aligned_vector<int> v(num * d);
+      std::default_random_engine gen1(tool::seed_source{}());
       for (int i = 0; i < num; i++) {
-        std::iota(shuffle.data() + i * Dim, shuffle.data() + (i + 1) * Dim,
-                  int(0));
-        std::shuffle(shuffle.data() + i * Dim, shuffle.data() + (i + 1) * Dim,
-                     gen1);
+        std::iota(v.data() + i * d, v.data() + (i + 1) * d, int(0));
+        std::shuffle(v.data() + i * d, v.data() + (i + 1) * d, gen1);
       }
+      shuffle = std::move(v);
     }
   }
-  cec_common(const std::string &dir_name) {
-    load_shift_shuffle(dir_name, Index);
-    load_rotate_matrix(dir_name, Index);
-    ins = 1;
+  cec_common(const std::string &dir_name, int idx, int d = Dim) {
+    set_dim(d);
+    load(dir_name, idx);
+  }
+
+public:
+  cec_common() = default;
+  cec_common(cec_common &&) = default;
+  cec_common(const cec_common &) = default;
+  cec_common &operator=(cec_common &&) = default;
+  cec_common &operator=(const cec_common &) = default;
+  cec_common(int _ins)
+    requires(Dim != runtime_dim)
+      : ins(_ins) {
+    generate();
+  }
+  cec_common(const std::string &dir_name)
+    requires(Dim != runtime_dim)
+  {
+    load(dir_name, Index);
+  }
+  // With runtime_dim, the dimension comes first.
+  cec_common(int d, int _ins)
+    requires(Dim == runtime_dim)
+      : ins(_ins) {
+    set_dim(d);
+    generate();
+  }
+  cec_common(int d, const std::string &dir_name)
+    requires(Dim == runtime_dim)
+  {
+    set_dim(d);
+    load(dir_name, Index);
   }
   constexpr static auto lower_bound() { return T(-100); }
   constexpr static auto upper_bound() { return T(100); }
   auto instance() const noexcept { return ins; }
   void set_instance(int _ins) noexcept { ins = _ins; }
   static constexpr auto has_basic_func() {
-    return requires(std::span<T, Dim> x) {
+    return requires(cec_detail::dim_span<T, Dim> x) {
       { Drived<Index, Dim, T>::evaluate(x) } -> std::same_as<T>;
     } || requires { requires Drived<Index, Dim, T>::is_basic(); };
   }
   static constexpr auto has_hybrid_func() {
-    return requires(std::span<T, Dim> x) {
+    return requires(cec_detail::dim_span<T, Dim> x) {
       { Drived<Index, Dim, T>::hybrid_evaluate(x) } -> std::same_as<T>;
     } || requires { requires Drived<Index, Dim, T>::is_hybrid(); };
   }
@@ -231,6 +498,14 @@ public:
     return (!has_basic_func()) && (!has_hybrid_func()) &&
            (has_composition_func());
   }
+  // Compositions that declare their components, all of them rotated, so
+  // that evaluate_batch can rotate them in one fused pass, with the
+  // dispatched kernel if one is registered and the compiled-in one if not.
+  static constexpr auto is_fused_composition() {
+    return is_composition_problem() && !std::is_same_v<T, long double> &&
+           Dim != runtime_dim &&
+           requires { Drived<Index, Dim, T>::components(); };
+  }
   static constexpr auto is_only_shift() {
     return is_basic_problem() &&
            requires { requires Drived<Index, Dim, T>::is_only_shift(); };
@@ -245,7 +520,7 @@ public:
   static constexpr auto optimum_num() noexcept { return T(100 * Index); }
 
   auto optimum_solution() const noexcept {
-    solution<T> x(shift.data(), shift.data() + Dim);
+    solution<T> x(shift.data(), shift.data() + this->dim());
     x.set_fitness(Drived<Index, Dim, T>::optimum_num());
     return x;
   }
@@ -257,16 +532,85 @@ public:
                            .ub = upper_bound(),
                            .optimum = optimum_solution()};
   }
+  static constexpr auto has_custom_operator() {
+    return !requires(cec_detail::dim_span<T, Dim> x) {
+      { Drived<Index, Dim, T>::evaluate(x) } -> std::same_as<T>;
+    } && !requires(cec_detail::dim_span<T, Dim> x) {
+      { Drived<Index, Dim, T>::hybrid_evaluate(x) } -> std::same_as<T>;
+    };
+  }
+  bool evaluate_batch(std::span<const T> X, int n, std::size_t stride,
+                      std::span<T> out) const noexcept {
+    if (!batch_fits(X, n, stride, this->dim(), out))
+      return false;
+    if constexpr (is_fused_composition()) {
+      // sr shifts and rotates every component of a block of points.
+      auto fused = [&](auto sr) {
+        constexpr int B = cec_detail::batch_block;
+        constexpr int M = table_num();
+        constexpr int len = M * Dim + M;
+        alignas(tool::cache_line_size) std::array<T, B * M * Dim> diff;
+        alignas(tool::cache_line_size) std::array<T, B * len> y;
+        const int st = static_cast<int>(stride);
+        for (int r0 = 0; r0 < n; r0 += B) {
+          const int nb = std::min(B, n - r0);
+          sr(X.data() + r0 * stride, nb, st, shift.data(), matrix.data(), Dim,
+             M, diff.data(), y.data());
+          for (int b = 0; b < nb; b++)
+            out[r0 + b] = cec_detail::calculate_composition_fused(
+                              std::span<const T, len>(y.data() + b * len, len),
+                              Drived<Index, Dim, T>::components(), shuffle) +
+                          Drived<Index, Dim, T>::optimum_num();
+        }
+        return true;
+      };
+      if (auto k = dispatched_kernels<T>())
+        return fused(k->cec.composition_sr);
+      if constexpr (cec_detail::simd::enabled<T>)
+        return fused([](auto... a) noexcept {
+          cec_detail::simd::composition_sr<simd_type<T>>(a...);
+        });
+    }
+    if constexpr (is_composition_problem() || has_custom_operator() ||
+                  Dim == runtime_dim) {
+      const auto &d = static_cast<const Drived<Index, Dim, T> &>(*this);
+      for (int r = 0; r < n; r++)
+        out[r] = d(X.subspan(r * stride, this->dim()));
+    } else {
+      constexpr int B = cec_detail::batch_block;
+      std::array<T, B * Dim> y;
+      for (int r0 = 0; r0 < n; r0 += B) {
+        const int nb = std::min(B, n - r0);
+        cec_detail::sr_batch_func<Dim, is_only_shift(), T>(
+            X.subspan(r0 * stride), nb, stride, y, shift, matrix);
+        for (int b = 0; b < nb; b++) {
+          std::span<T, Dim> yb(y.data() + b * Dim, Dim);
+          if constexpr (is_hybrid_problem()) {
+            std::array<T, Dim> z;
+            for (int i = 0; i < Dim; i++)
+              z[i] = yb[shuffle[i]];
+            out[r0 + b] = Drived<Index, Dim, T>::hybrid_evaluate(z) +
+                          Drived<Index, Dim, T>::optimum_num();
+          } else {
+            out[r0 + b] = Drived<Index, Dim, T>::evaluate(yb) +
+                          Drived<Index, Dim, T>::optimum_num();
+          }
+        }
+      }
+    }
+    return true;
+  }
   auto operator()(std::span<const T> x) const noexcept {
     static_assert(is_composition_problem() || is_hybrid_problem() ||
                       is_basic_problem(),
                   "CRTP FAILED");
     if constexpr (!is_composition_problem()) {
-      std::array<T, Dim> y;
+      const int d = this->dim();
+      cec_detail::dim_array<T, Dim> y(d);
       cec_detail::sr_func<Dim, is_only_shift(), T>(x, y, shift, matrix);
       if constexpr (is_hybrid_problem()) {
-        std::array<T, Dim> z;
-        for (int i = 0; i < Dim; i++)
+        cec_detail::dim_array<T, Dim> z(d);
+        for (int i = 0; i < d; i++)
           z[i] = y[shuffle[i]];
         return Drived<Index, Dim, T>::hybrid_evaluate(z) +
                Drived<Index, Dim, T>::optimum_num();
@@ -275,8 +619,8 @@ public:
                Drived<Index, Dim, T>::optimum_num();
       }
     } else {
-      return Drived<Index, Dim, T>::composition_evaluate(x, shift, matrix,
-                                                         shuffle) +
+      return Drived<Index, Dim, T>::composition_evaluate(
+                 x.first(this->dim()), shift, matrix, shuffle) +
              Drived<Index, Dim, T>::optimum_num();
     }
   }
@@ -0,0 +1,25 @@
+#pragma once
+#include "kernel_set.hpp"
+#include "../cec/cec_base_problem_simd.hpp"
+#include "../large_scale/simd_kernels.hpp"
+
+namespace sevobench::problem {
+
+template <typename V>
+constexpr auto make_kernel_set(simd_level level) noexcept {
+  namespace k = simd::kernels;
+  namespace c = cec_detail::simd;
+  kernel_set<k::scalar_t<V>> s{.level = level};
+  s.large_scale = {k::sphere<V>,  k::elliptic<V>,   k::rastrigin<V>,
+                   k::ackley<V>,  k::rosenbrock<V>, k::schwefel_1<V>};
+  s.cec = {c::zakharov<V>,     c::sum_diff_pow<V>, c::rosenbrock<V>,
+           c::escaffer6<V>,    c::rastrigin<V>,    c::levy<V>,
+           c::bent_cigar<V>,   c::hgbat<V>,        c::katsuura<V>,
+           c::ackley<V>,       c::schwefel<V>,     c::schwefel_F7<V>,
+           c::happycat<V>,     c::grie_rosen<V>,   c::griewank<V>,
+           c::ellips<V>,       c::discus<V>,       c::bi_rastrigin<V>,
+           c::weierstrass<V>,  c::composition_sr<V>};
+  return s;
+}
+
+} // namespace sevobench::problem
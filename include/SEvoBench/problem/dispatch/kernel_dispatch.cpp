@@ -0,0 +1,57 @@
+// Baseline half of sevobench_add_kernel_dispatch(): detects the CPU once and
+// registers every kernel_isa.cpp build it can run. SEVOBENCH_KERNEL_HAS_<ISA>
+// tells which builds were compiled into the target.
+#define VCL_NAMESPACE sevobench_vcl_detect
+
+#include "kernel_registry.hpp"
+#include "../../version2/instrset_detect.cpp"
+
+namespace sevobench::problem::dispatch {
+
+#define SEVOBENCH_DECLARE_KERNELS(isa)                                        \
+  const kernel_set<float> &isa##_f32() noexcept;                             \
+  const kernel_set<double> &isa##_f64() noexcept;
+#ifdef SEVOBENCH_KERNEL_HAS_SSE42
+SEVOBENCH_DECLARE_KERNELS(sse42)
+#endif
+#ifdef SEVOBENCH_KERNEL_HAS_AVX2
+SEVOBENCH_DECLARE_KERNELS(avx2)
+#endif
+#ifdef SEVOBENCH_KERNEL_HAS_AVX512
+SEVOBENCH_DECLARE_KERNELS(avx512)
+#endif
+#undef SEVOBENCH_DECLARE_KERNELS
+
+inline simd_level detect_simd_level() noexcept {
+  const auto iset = sevobench_vcl_detect::instrset_detect();
+  if (iset >= 10 && sevobench_vcl_detect::hasFMA3())
+    return simd_level::avx512;
+  if (iset >= 8 && sevobench_vcl_detect::hasFMA3())
+    return simd_level::avx2;
+  if (iset >= 6)
+    return simd_level::sse42;
+  return simd_level::none;
+}
+
+[[maybe_unused]] inline void add_kernels(const kernel_set<float> &f,
+                                         const kernel_set<double> &d) {
+  if (f.level <= detect_simd_level()) {
+    kernel_registry<float>::add(f);
+    kernel_registry<double>::add(d);
+  }
+}
+
+[[maybe_unused]] const bool registered = [] {
+#ifdef SEVOBENCH_KERNEL_HAS_SSE42
+  add_kernels(sse42_f32(), sse42_f64());
+#endif
+#ifdef SEVOBENCH_KERNEL_HAS_AVX2
+  add_kernels(avx2_f32(), avx2_f64());
+#endif
+#ifdef SEVOBENCH_KERNEL_HAS_AVX512
+  add_kernels(avx512_f32(), avx512_f64());
+#endif
+  return true;
+}();
+
+} // namespace sevobench::problem::dispatch
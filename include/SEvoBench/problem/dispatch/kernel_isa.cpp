@@ -0,0 +1,35 @@
+// Compiled once per instruction set by sevobench_add_kernel_dispatch() with
+// SEVOBENCH_KERNEL_ISA set to sse42, avx2 or avx512. Each build puts the
+// vector classes in its own namespace, and -fno-weak keeps the inline
+// functions it instantiates local, so no kernel symbol is shared between the
+// builds or with the baseline code; only the accessors below are exported.
+#ifndef SEVOBENCH_KERNEL_ISA
+#error "SEVOBENCH_KERNEL_ISA must be defined"
+#endif
+
+#define SEVOBENCH_CAT_(a, b) a##b
+#define SEVOBENCH_CAT(a, b) SEVOBENCH_CAT_(a, b)
+#define VCL_NAMESPACE SEVOBENCH_CAT(sevobench_vcl_, SEVOBENCH_KERNEL_ISA)
+
+#include "kernel_build.hpp"
+
+namespace sevobench::problem::dispatch {
+
+static_assert(simd_id() == static_cast<int>(simd_level::SEVOBENCH_KERNEL_ISA),
+              "KERNEL ISA DOES NOT MATCH THE COMPILER FLAGS");
+
+const kernel_set<float> &
+SEVOBENCH_CAT(SEVOBENCH_KERNEL_ISA, _f32)() noexcept {
+  static constexpr auto k = make_kernel_set<simd_type<float>>(
+      simd_level::SEVOBENCH_KERNEL_ISA);
+  return k;
+}
+
+const kernel_set<double> &
+SEVOBENCH_CAT(SEVOBENCH_KERNEL_ISA, _f64)() noexcept {
+  static constexpr auto k = make_kernel_set<simd_type<double>>(
+      simd_level::SEVOBENCH_KERNEL_ISA);
+  return k;
+}
+
+} // namespace sevobench::problem::dispatch
@@ -0,0 +1,64 @@
+#pragma once
+#include "../large_scale/simd_type.hpp"
+#include "kernel_set.hpp"
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace sevobench::problem {
+
+// Kernel sets compiled for other instruction sets register themselves here
+// during static initialisation (see kernel_dispatch.cpp); problems ask for
+// the widest one that beats what the including translation unit was built
+// for. sevobench_add_kernel_dispatch() defines SEVOBENCH_KERNEL_DISPATCH;
+// without it problems never look here and keep their compile-time kernels.
+template <std::floating_point T> class kernel_registry {
+  static inline std::array<std::atomic<const kernel_set<T> *>, 3> slots{};
+  static inline std::atomic<const kernel_set<T> *> widest{nullptr};
+
+public:
+  static void add(const kernel_set<T> &k) noexcept {
+    if (k.level == simd_level::none)
+      return;
+    slots[static_cast<int>(k.level)].store(&k, std::memory_order_release);
+    auto w = widest.load(std::memory_order_relaxed);
+    while ((!w || w->level <= k.level) &&
+           !widest.compare_exchange_weak(w, &k, std::memory_order_release,
+                                         std::memory_order_relaxed))
+      ;
+  }
+  static const kernel_set<T> *
+  best(simd_level above = simd_level::none) noexcept {
+    if (above == simd_level::none)
+      return widest.load(std::memory_order_acquire);
+    for (int i = static_cast<int>(slots.size()) - 1;
+         i > static_cast<int>(above); i--)
+      if (auto k = slots[i].load(std::memory_order_acquire))
+        return k;
+    return nullptr;
+  }
+};
+
+template <typename T>
+inline constexpr simd_level compiled_simd_level =
+    std::is_same_v<T, long double> ? simd_level::none
+                                   : static_cast<simd_level>(simd_id());
+
+// The registry is read until it has a set, which is then kept; a problem
+// evaluated during static initialisation thus runs its compile-time kernels
+// until the others are registered.
+template <std::floating_point T>
+inline const kernel_set<T> *dispatched_kernels() noexcept {
+#ifdef SEVOBENCH_KERNEL_DISPATCH
+  if constexpr (!std::is_same_v<T, long double> &&
+                compiled_simd_level<T> != simd_level::avx512) {
+    thread_local const kernel_set<T> *k = nullptr;
+    if (!k)
+      k = kernel_registry<T>::best(compiled_simd_level<T>);
+    return k;
+  }
+#endif
+  return nullptr;
+}
+
+} // namespace sevobench::problem
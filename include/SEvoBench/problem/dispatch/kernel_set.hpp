@@ -0,0 +1,27 @@
+#pragma once
+#include <concepts>
+
+namespace sevobench::problem {
+
+enum class simd_level : int { none = -1, sse42 = 0, avx2 = 1, avx512 = 2 };
+
+// One instruction set's build of every runtime-length SIMD kernel. Only the
+// pointers live here; kernel_build.hpp fills them in, so that code which
+// merely calls the kernels never sees vectorclass.
+template <std::floating_point T> struct kernel_set {
+  using kernel = T (*)(const T *, int) noexcept;
+  using composition_kernel = void (*)(const T *, int, int, const T *,
+                                      const T *, int, int, T *, T *) noexcept;
+  simd_level level = simd_level::none;
+  struct {
+    kernel sphere, elliptic, rastrigin, ackley, rosenbrock, schwefel_1;
+  } large_scale{};
+  struct {
+    kernel zakharov, sum_diff_pow, rosenbrock, escaffer6, rastrigin, levy,
+        bent_cigar, hgbat, katsuura, ackley, schwefel, schwefel_F7, happycat,
+        grie_rosen, griewank, ellips, discus, bi_rastrigin, weierstrass;
+    composition_kernel composition_sr;
+  } cec{};
+};
+
+} // namespace sevobench::problem
@@ -0,0 +1,107 @@
+#pragma once
+#include "../../common/tool.hpp"
+#include "simd_type.hpp"
+#include <span>
+
+namespace sevobench::problem::simd {
+
+// Block-diagonal rotation of the grouped CEC2010 problems. Every G x G block
+// is stored transposed with its columns zero-padded to whole vectors, so
+// y = M (x - o) is G broadcast-FMAs per output vector, and a batch of
+// candidates reuses every loaded column.
+template <int G, std::floating_point T> class block_rotation {
+  static constexpr bool vectorized =
+      !std::is_same_v<T, long double> && (simd_id() >= 0);
+  static constexpr int lanes = [] {
+    if constexpr (vectorized)
+      return simd_width<T>;
+    else
+      return 1;
+  }();
+  static constexpr int rows = (G + lanes - 1) / lanes * lanes;
+  static constexpr int vecs = rows / lanes;
+  // Candidates per pass, sized so the accumulators stay in registers.
+  static constexpr int block = std::max(1, (simd_id() >= 2 ? 28 : 14) / vecs);
+
+  tool::shared_array<T> mt;
+  int groups_ = 0;
+
+  template <int NB>
+  void apply_block(const T *X, std::size_t stride, const T *o, T *Y,
+                   std::size_t y_stride, int first, int last) const noexcept {
+    for (int g = first; g < last; g++) {
+      const T *m = mt.data() + std::size_t(g) * G * rows;
+      const int off = g * G;
+      if constexpr (vectorized) {
+        using V = simd_type<T>;
+        std::array<std::array<V, vecs>, NB> acc;
+        for (auto &a : acc)
+          a.fill(V(0));
+        for (int c = 0; c < G; c++) {
+          std::array<V, NB> z;
+          for (int b = 0; b < NB; b++)
+            z[b] = V(X[b * stride + off + c] - o[off + c]);
+          for (int v = 0; v < vecs; v++) {
+            V col;
+            col.load_a(m + c * rows + v * lanes);
+            for (int b = 0; b < NB; b++)
+              acc[b][v] = mul_add(z[b], col, acc[b][v]);
+          }
+        }
+        for (int b = 0; b < NB; b++) {
+          T *y = Y + b * y_stride + off;
+          for (int v = 0; v < vecs; v++) {
+            if (v < vecs - 1)
+              acc[b][v].store(y + v * lanes);
+            else
+              acc[b][v].store_partial(G - v * lanes, y + v * lanes);
+          }
+        }
+      } else {
+        for (int b = 0; b < NB; b++) {
+          T *y = Y + b * y_stride + off;
+          std::fill_n(y, G, T(0));
+          for (int c = 0; c < G; c++) {
+            const T z = X[b * stride + off + c] - o[off + c];
+            for (int r = 0; r < G; r++)
+              y[r] += z * m[c * rows + r];
+          }
+        }
+      }
+    }
+  }
+
+public:
+  block_rotation() = default;
+  // m holds the groups' G x G matrices one after another, row-major.
+  block_rotation(std::span<const T> m, int groups) : groups_(groups) {
+    tool::aligned_vector<T> t(std::size_t(groups) * G * rows, T(0));
+    for (int g = 0; g < groups; g++)
+      for (int r = 0; r < G; r++)
+        for (int c = 0; c < G; c++)
+          t[(std::size_t(g) * G + c) * rows + r] =
+              m[(std::size_t(g) * G + r) * G + c];
+    mt = std::move(t);
+  }
+
+  auto groups() const noexcept { return groups_; }
+
+  // Rotates the first groups() * G coordinates of x - o for n candidates,
+  // candidate b being read at X + b * stride and written at Y + b * y_stride.
+  void apply(const T *X, int n, std::size_t stride, const T *o, T *Y,
+             std::size_t y_stride) const noexcept {
+    int b = 0;
+    for (; b + block <= n; b += block)
+      apply_block<block>(X + b * stride, stride, o, Y + b * y_stride,
+                         y_stride, 0, groups_);
+    for (; b < n; b++)
+      apply_block<1>(X + b * stride, stride, o, Y + b * y_stride, y_stride, 0,
+                     groups_);
+  }
+  // Rotates group g of one candidate only.
+  void apply_group(int g, const T *x, const T *o, T *y) const noexcept {
+    apply_block<1>(x, 0, o, y, 0, g, g + 1);
+  }
+};
+
+} // namespace sevobench::problem::simd
@@ -1,18 +1,76 @@
 #pragma once
 #include "../../common/tool.hpp"
 #include "../problem.hpp"
+#include "../dispatch/kernel_registry.hpp"
+#include "block_rotation.hpp"
 #include "cec_base_problem_simd.hpp"
 #include <vector>
 namespace sevobench::problem::simd {
+template <bool Using_SIMD, int W, std::floating_point T>
+struct compiled_kernels {
+  template <int N> static auto sphere(const T *x) noexcept {
+    return simd::sphere<Using_SIMD, N, W, T>(x);
+  }
+  template <int N> static auto elliptic(const T *x) noexcept {
+    return simd::elliptic<Using_SIMD, N, W, T>(x);
+  }
+  template <int N> static auto rastrigin(const T *x) noexcept {
+    return simd::rastrigin<Using_SIMD, N, W, T>(x);
+  }
+  template <int N> static auto ackley(const T *x) noexcept {
+    return simd::ackley<Using_SIMD, N, W, T>(x);
+  }
+  template <int N> static auto rosenbrock(const T *x) noexcept {
+    return simd::rosenbrock<Using_SIMD, N, W, T>(x);
+  }
+  template <int N> static auto schwefel_1(const T *x) noexcept {
+    return simd::schwefel_1<Using_SIMD, N, W, T>(x);
+  }
+};
+
+template <std::floating_point T> struct runtime_kernels {
+  const kernel_set<T> *set;
+  template <int N> auto sphere(const T *x) const noexcept {
+    return set->large_scale.sphere(x, N);
+  }
+  template <int N> auto elliptic(const T *x) const noexcept {
+    return set->large_scale.elliptic(x, N);
+  }
+  template <int N> auto rastrigin(const T *x) const noexcept {
+    return set->large_scale.rastrigin(x, N);
+  }
+  template <int N> auto ackley(const T *x) const noexcept {
+    return set->large_scale.ackley(x, N);
+  }
+  template <int N> auto rosenbrock(const T *x) const noexcept {
+    return set->large_scale.rosenbrock(x, N);
+  }
+  template <int N> auto schwefel_1(const T *x) const noexcept {
+    return set->large_scale.schwefel_1(x, N);
+  }
+};
+
+// Kernels that make cec2010_detail::group_calc store the wanted blocks'
+// values instead of summing every block.
+template <typename K, std::floating_point T> struct partial_kernels : K {
+  std::span<const char> wanted;
+  std::span<T> values;
+};
+
+namespace cec2010_detail {
+inline constexpr int batch_block = 8;
+} // namespace cec2010_detail
+
 template <bool Using_SIMD, int W, int G, int Index, int Dim,
           std::floating_point T,
           template <bool, int, int, int, int, std::floating_point> class Drived>
-  requires(Dim % G == 0) && (Dim % (2 * G) == 0)
+  requires(Dim > 0) && (Dim % G == 0) && (Dim % (2 * G) == 0)
 class cec2010_common : public problem_common<Index, Dim, T> {
 protected:
-  std::vector<T> shift;
-  std::vector<T> matrix;
-  std::vector<int> shuffle;
+  tool::shared_array<T> shift;
+  block_rotation<G, T> rotation;
+  tool::shared_array<int> shuffle;
+  const kernel_set<T> *kernels = nullptr;
   int ins = 0;
   using Dri = Drived<Using_SIMD, W, G, Index, Dim, T>;
 
@@ -21,21 +79,27 @@ public:
     constexpr auto id = Dri::problem_type_id();
     constexpr auto lb = Dri::lower_bound();
     constexpr auto ub = Dri::upper_bound();
-    std::random_device rd{};
+    if constexpr (!std::is_same_v<T, long double>)
+      kernels = kernel_registry<T>::best(
+          Using_SIMD ? static_cast<simd_level>(simd_id()) : simd_level::none);
+    tool::seed_source rd{};
     std::default_random_engine gen{rd()};
     std::uniform_real_distribution<T> dis(lb, ub);
-    shift.resize(Dim);
-    std::generate_n(shift.data(), Dim, [&] { return dis(gen); });
+    tool::aligned_vector<T> s(Dim);
+    std::generate_n(s.data(), Dim, [&] { return dis(gen); });
+    shift = std::move(s);
     if constexpr (id != 1 && id != 5) {
-      shuffle.resize(Dim);
-      std::iota(shuffle.begin(), shuffle.end(), int(0));
-      std::shuffle(shuffle.begin(), shuffle.end(), gen);
+      tool::aligned_vector<int> p(Dim);
+      std::iota(p.begin(), p.end(), int(0));
+      std::shuffle(p.begin(), p.end(), gen);
+      shuffle = std::move(p);
       if constexpr (need_rotate()) {
-        matrix.resize(total() * G * G);
+        tool::aligned_vector<T> m(total() * G * G);
         for (int i = 0; i < total(); i++) {
           tool::generate_rotate_vector<G>(
-              std::span<T>(matrix.data() + i * G * G, G * G));
+              std::span<T>(m.data() + i * G * G, G * G));
         }
+        rotation = block_rotation<G, T>(m, total());
       }
     }
   }
@@ -56,23 +120,105 @@ public:
   }
 
   auto operator()(std::span<const T> x) const noexcept {
-    constexpr auto id = Dri::problem_type_id();
-    std::array<T, Dim> tmp;
-    if constexpr (id == 1 || id == 5) {
-      shift_func<Dim, T>(x.data(), tmp.data(), shift.data());
-    } else {
-      for (int i = 0; i < Dim; i++) {
-        auto idx = shuffle[i];
-        tmp[idx] = x[idx] - shift[idx];
-      }
-      if constexpr (need_rotate()) {
-        for (int i = 0; i < total(); i++)
-          rotate_func<G, T>(tmp.data() + i * G, matrix.data() + i * G * G);
-      }
+    alignas(tool::cache_line_size) std::array<T, Dim> tmp;
+    transform(x.data(), 1, 0, tmp.data());
+    return evaluate_transformed(tmp);
+  }
+  bool evaluate_batch(std::span<const T> X, int n, std::size_t stride,
+                      std::span<T> out) const noexcept {
+    constexpr int B = cec2010_detail::batch_block;
+    if (!batch_fits(X, n, stride, Dim, out))
+      return false;
+    alignas(tool::cache_line_size) std::array<T, B * Dim> y;
+    for (int r0 = 0; r0 < n; r0 += B) {
+      const int nb = std::min(B, n - r0);
+      transform(X.data() + r0 * stride, nb, stride, y.data());
+      for (int b = 0; b < nb; b++)
+        out[r0 + b] = evaluate_transformed(
+            std::span<const T, Dim>(y.data() + b * Dim, Dim));
     }
-    return Dri::evaluate(tmp);
+    return true;
   }
 
+  // Re-evaluates a solution after a few coordinates changed by recomputing
+  // only the blocks (rotated groups, or the remaining coordinates) they fall
+  // in; problems that are not group-separable are evaluated in full. The
+  // evaluator refers to the problem, which must outlive it.
+  class delta_evaluator {
+    const cec2010_common *p;
+    std::vector<T> values;
+    std::vector<T> trial;
+    std::vector<char> wanted;
+    tool::aligned_vector<T> z;
+
+    constexpr static bool grouped() {
+      constexpr auto id = problem_type_id();
+      return id == 2 || id == 3 || id == 4;
+    }
+    constexpr static int blocks() {
+      if constexpr (grouped())
+        return total() + (rest() > 0 ? 1 : 0);
+      else
+        return 1;
+    }
+    constexpr static int block_of(int i) {
+      return std::min(i / G, blocks() - 1);
+    }
+    T evaluate_wanted(std::span<const T> x) noexcept {
+      if constexpr (!grouped()) {
+        if (wanted[0])
+          trial[0] = (*p)(x);
+        return wanted[0] ? trial[0] : values[0];
+      } else {
+        for (int b = 0; b < total(); b++)
+          if (wanted[b])
+            p->rotation.apply_group(b, x.data(), p->shift.data(), z.data());
+        if (rest() > 0 && wanted[total()])
+          for (int i = total() * G; i < Dim; i++)
+            z[i] = x[i] - p->shift[i];
+        const std::span<const T, Dim> zs(z.data(), Dim);
+        if (p->kernels)
+          Dri::evaluate(zs, partial_kernels<runtime_kernels<T>, T>{
+                                {p->kernels}, wanted, trial});
+        else
+          Dri::evaluate(zs,
+                        partial_kernels<compiled_kernels<Using_SIMD, W, T>, T>{
+                            {}, wanted, trial});
+        T sum(0);
+        for (int b = 0; b < blocks(); b++)
+          sum += wanted[b] ? trial[b] : values[b];
+        return sum;
+      }
+    }
+
+  public:
+    explicit delta_evaluator(const cec2010_common &_p)
+        : p(&_p), values(blocks()), trial(blocks()), wanted(blocks()),
+          z(Dim) {}
+    // Evaluates x in full and makes it the base solution.
+    T reset(std::span<const T> x) noexcept {
+      std::fill(wanted.begin(), wanted.end(), char(1));
+      const auto v = evaluate_wanted(x);
+      accept();
+      return v;
+    }
+    // Fitness of x, which differs from the base solution only at changed.
+    T evaluate(std::span<const T> x, std::span<const int> changed) noexcept {
+      std::fill(wanted.begin(), wanted.end(), char(0));
+      for (auto i : changed)
+        wanted[block_of(i)] = 1;
+      return evaluate_wanted(x);
+    }
+    // Makes the solution last passed to evaluate() the base solution.
+    void accept() noexcept {
+      for (int b = 0; b < blocks(); b++)
+        if (wanted[b])
+          values[b] = trial[b];
+      std::fill(wanted.begin(), wanted.end(), char(0));
+    }
+  };
+  auto make_delta_evaluator() const { return delta_evaluator(*this); }
+
   constexpr static auto need_rotate() noexcept { return true; }
   constexpr static auto problem_type_id() { return Dri::problem_type_id(); }
 
@@ -80,13 +226,48 @@ public:
     constexpr auto id = problem_type_id();
     return id == 2 ? 1 : id == 3 ? (Dim / (2 * G)) : Dim / (G);
   }
+  constexpr static auto rest() { return Dim - total() * G; }
+
+private:
+  // Shift, shuffle and rotate n candidates into Y in one pass; the shuffle
+  // scatter writes every coordinate back to its own index.
+  void transform(const T *X, int n, std::size_t stride, T *Y) const noexcept {
+    constexpr auto id = Dri::problem_type_id();
+    if constexpr (id != 1 && id != 5 && need_rotate()) {
+      rotation.apply(X, n, stride, shift.data(), Y, Dim);
+      for (int b = 0; b < n; b++)
+        for (int i = total() * G; i < Dim; i++)
+          Y[b * Dim + i] = X[b * stride + i] - shift[i];
+    } else {
+      for (int b = 0; b < n; b++)
+        shift_func<Dim, T>(X + b * stride, Y + b * Dim, shift.data());
+    }
+  }
+  auto evaluate_transformed(std::span<const T, Dim> z) const noexcept {
+    if (kernels)
+      return Dri::evaluate(z, runtime_kernels<T>{kernels});
+    return Dri::evaluate(z, compiled_kernels<Using_SIMD, W, T>{});
+  }
 };
 
 namespace cec2010_detail {
 
+// Sums f over the groups and g over the remaining coordinates. Kernels that
+// carry wanted/values (see cec2010_common::delta_evaluator) instead get the
+// wanted blocks' values stored and nothing else computed.
 template <int total, int G, int Dim, std::floating_point T>
-inline auto group_calc(auto f, [[maybe_unused]] auto g, const T *x) noexcept {
+inline auto group_calc(auto f, [[maybe_unused]] auto g, const T *x,
+                       [[maybe_unused]] const auto &k) noexcept {
   T sum(0);
+  if constexpr (requires { k.values; }) {
+    for (int i = 0; i < total; i++)
+      if (k.wanted[i])
+        k.values[i] = f(x + i * G);
+    if constexpr (total * G < Dim)
+      if (k.wanted[total])
+        k.values[total] = g(x + total * G);
+    return sum;
+  }
   for (int i = 0; i < total; i++) {
     sum += f(x + i * G);
   }
@@ -106,8 +287,8 @@ class cec2010_template<Using_SIMD, W, G, 1, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, 1, Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
-    return elliptic<Using_SIMD, Dim, W, T>(x.data());
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
+    return k.template elliptic<Dim>(x.data());
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -119,8 +300,8 @@ class cec2010_template<Using_SIMD, W, G, 2, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, 2, Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
-    return rastrigin<Using_SIMD, Dim, W, T>(x.data());
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
+    return k.template rastrigin<Dim>(x.data());
   }
   constexpr static auto lower_bound() noexcept { return T(-5); }
   constexpr static auto upper_bound() noexcept { return T(5); }
@@ -132,8 +313,8 @@ class cec2010_template<Using_SIMD, W, G, 3, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, 3, Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
-    return ackley<Using_SIMD, Dim, W, T>(x.data());
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
+    return k.template ackley<Dim>(x.data());
   }
   constexpr static auto lower_bound() noexcept { return T(-32); }
   constexpr static auto upper_bound() noexcept { return T(32); }
@@ -148,12 +329,11 @@ public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_\
 common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        [](const T *x) {
-          return T(1000000) * elliptic<Using_SIMD, G, W, T>(x);
-        },
-        elliptic<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return T(1000000) * k.template elliptic<G>(p); },
+        [&k](const T *p) { return k.template elliptic<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -167,12 +347,11 @@ class cec2010_template<Using_SIMD, W, G, 5, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        [](const T *x) {
-          return T(1000000) * rastrigin<Using_SIMD, G, W, T>(x);
-        },
-        rastrigin<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return T(1000000) * k.template rastrigin<G>(p); },
+        [&k](const T *p) { return k.template rastrigin<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-5); }
   constexpr static auto upper_bound() noexcept { return T(5); }
@@ -186,10 +365,11 @@ class cec2010_template<Using_SIMD, W, G, 6, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        [](const T *x) { return T(1000000) * ackley<Using_SIMD, G, W, T>(x); },
-        ackley<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return T(1000000) * k.template ackley<G>(p); },
+        [&k](const T *p) { return k.template ackley<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-32); }
   constexpr static auto upper_bound() noexcept { return T(32); }
@@ -203,12 +383,11 @@ class cec2010_template<Using_SIMD, W, G, 7, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        [](const T *x) {
-          return T(1000000) * schwefel_1<Using_SIMD, G, W, T>(x);
-        },
-        sphere<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return T(1000000) * k.template schwefel_1<G>(p); },
+        [&k](const T *p) { return k.template sphere<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -223,12 +402,11 @@ class cec2010_template<Using_SIMD, W, G, 8, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        [](const T *x) {
-          return T(1000000) * rosenbrock<Using_SIMD, G, W, T>(x);
-        },
-        sphere<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return T(1000000) * k.template rosenbrock<G>(p); },
+        [&k](const T *p) { return k.template sphere<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -243,10 +421,11 @@ class cec2010_template<Using_SIMD, W, G, 9, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        elliptic<Using_SIMD, G, W, T>,
-        elliptic<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template elliptic<G>(p); },
+        [&k](const T *p) { return k.template elliptic<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -260,10 +439,11 @@ class cec2010_template<Using_SIMD, W, G, 10, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        rastrigin<Using_SIMD, G, W, T>,
-        rastrigin<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template rastrigin<G>(p); },
+        [&k](const T *p) { return k.template rastrigin<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-5); }
   constexpr static auto upper_bound() noexcept { return T(5); }
@@ -277,10 +457,11 @@ class cec2010_template<Using_SIMD, W, G, 11, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        ackley<Using_SIMD, G, W, T>,
-        ackley<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template ackley<G>(p); },
+        [&k](const T *p) { return k.template ackley<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-32); }
   constexpr static auto upper_bound() noexcept { return T(32); }
@@ -294,10 +475,11 @@ class cec2010_template<Using_SIMD, W, G, 12, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        schwefel_1<Using_SIMD, G, W, T>,
-        sphere<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template schwefel_1<G>(p); },
+        [&k](const T *p) { return k.template sphere<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -312,10 +494,11 @@ class cec2010_template<Using_SIMD, W, G, 13, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, 13, Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        rosenbrock<Using_SIMD, G, W, T>,
-        sphere<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template rosenbrock<G>(p); },
+        [&k](const T *p) { return k.template sphere<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -330,10 +513,11 @@ class cec2010_template<Using_SIMD, W, G, 14, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        elliptic<Using_SIMD, G, W, T>,
-        elliptic<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template elliptic<G>(p); },
+        [&k](const T *p) { return k.template elliptic<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -347,10 +531,11 @@ class cec2010_template<Using_SIMD, W, G, 15, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        rastrigin<Using_SIMD, G, W, T>,
-        rastrigin<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template rastrigin<G>(p); },
+        [&k](const T *p) { return k.template rastrigin<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-5); }
   constexpr static auto upper_bound() noexcept { return T(5); }
@@ -364,10 +549,11 @@ class cec2010_template<Using_SIMD, W, G, 16, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        ackley<Using_SIMD, G, W, T>,
-        ackley<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template ackley<G>(p); },
+        [&k](const T *p) { return k.template ackley<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-32); }
   constexpr static auto upper_bound() noexcept { return T(32); }
@@ -381,10 +567,11 @@ class cec2010_template<Using_SIMD, W, G, 17, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        schwefel_1<Using_SIMD, G, W, T>,
-        schwefel_1<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template schwefel_1<G>(p); },
+        [&k](const T *p) { return k.template schwefel_1<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -399,10 +586,11 @@ class cec2010_template<Using_SIMD, W, G, 18, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
     return cec2010_detail::group_calc<Base::total(), G, Dim, T>(
-        rosenbrock<Using_SIMD, G, W, T>,
-        rosenbrock<Using_SIMD, Dim - Base::total() * G, W, T>, x.data());
+        [&k](const T *p) { return k.template rosenbrock<G>(p); },
+        [&k](const T *p) { return k.template rosenbrock<Base::rest()>(p); },
+        x.data(), k);
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -417,8 +605,8 @@ class cec2010_template<Using_SIMD, W, G, 19, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
-    return schwefel_1<Using_SIMD, Dim, W, T>(x.data());
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
+    return k.template schwefel_1<Dim>(x.data());
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -433,8 +621,8 @@ class cec2010_template<Using_SIMD, W, G, 20, Dim, T>
 public:
   using cec2010_common<Using_SIMD, W, G, Base::index(), Dim, T,
                        cec2010_template>::cec2010_common;
-  static auto evaluate(std::span<const T, Dim> x) noexcept {
-    return rosenbrock<Using_SIMD, Dim, W, T>(x.data());
+  static auto evaluate(std::span<const T, Dim> x, const auto &k) noexcept {
+    return k.template rosenbrock<Dim>(x.data());
   }
   constexpr static auto lower_bound() noexcept { return T(-100); }
   constexpr static auto upper_bound() noexcept { return T(100); }
@@ -443,9 +631,13 @@ public:
 };
 template <int G, bool Using_SIMD = (simd_id() > 0), int W = 8>
 struct cec2010_setting {
+  template <std::floating_point T> static constexpr int width() noexcept {
+    if constexpr (Using_SIMD)
+      return std::min(simd_width<T>, W);
+    else
+      return -1;
+  }
   template <int Index, int Dim, std::floating_point T>
-  using cec2010 =
-      cec2010_template<Using_SIMD, Using_SIMD ? std::min(simd_width<T>, W) : -1,
-                       G, Index, Dim, T>;
+  using cec2010 = cec2010_template<Using_SIMD, width<T>(), G, Index, Dim, T>;
 };
 } // namespace sevobench::problem::simd
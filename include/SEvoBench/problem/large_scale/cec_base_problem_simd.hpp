@@ -1,7 +1,5 @@
 #pragma once
-#include "simd_type.hpp"
-#include "../../version2/vectormath_exp.h"
-#include "../../version2/vectormath_trig.h"
+#include "simd_kernels.hpp"
 #include <numbers>
 #include <numeric>
 
@@ -23,16 +21,24 @@ inline void rotate_func(T *x, const T *m) noexcept {
 
 template <bool Using_SIMD, int N, int W, std::floating_point T>
 inline auto sphere(const T *x) noexcept {
-  return std::inner_product(x, x + N, x, T(0));
+  if constexpr (!Using_SIMD) {
+    return std::inner_product(x, x + N, x, T(0));
+  } else {
+    return kernels::sphere<vsimd_type<T, W>>(x, N);
+  }
 }
 
 template <bool Using_SIMD, int N, int W, std::floating_point T>
 inline auto rosenbrock(const T *x) noexcept {
-  T sum(0);
-  for (int i = 0; i < N - 1; i++)
-    sum +=
-        x[i] * x[i] + 100 * tool::Pow<2>(x[i + 1] + 1 - tool::Pow<2>(x[i] + 1));
-  return sum;
+  if constexpr (!Using_SIMD) {
+    T sum(0);
+    for (int i = 0; i < N - 1; i++)
+      sum += x[i] * x[i] +
+             100 * tool::Pow<2>(x[i + 1] + 1 - tool::Pow<2>(x[i] + 1));
+    return sum;
+  } else {
+    return kernels::rosenbrock<vsimd_type<T, W>>(x, N);
+  }
 }
 template <bool Using_SIMD, int N, int W, std::floating_point T>
 inline auto rastrigin(const T *x) noexcept {
@@ -41,27 +47,7 @@ inline auto rastrigin(const T *x) noexcept {
              return l + r * r - 10 * std::cos(2 * std::numbers::pi_v<T> * r);
            });
   } else {
-    vsimd_type<T, W> v(0);
-    vsimd_type<T, W> w(0);
-    T sum(10 * N);
-    constexpr int RN = N & (-W);
-    for (int i = 0; i < RN; i += W) {
-      vsimd_type<T, W> tmp;
-      tmp.load(x + i);
-      v += tmp * tmp;
-      w -= 10 * cospi(2 * tmp);
-    }
-    if constexpr (RN < N) {
-      vsimd_type<T, W> tmp;
-      tmp.load_partial(N - RN, x + RN);
-      v += tmp * tmp;
-      w -= 10 * cospi(2 * tmp);
-    }
-    sum += horizontal_add(v + w);
-    if constexpr (RN < N) {
-      sum += 10 * (W - (N - RN));
-    }
-    return sum;
+    return kernels::rastrigin<vsimd_type<T, W>>(x, N);
   }
 }
 
@@ -77,28 +63,7 @@ inline auto ackley(const T *x) noexcept {
     return 20 + std::numbers::e_v<T> - std::exp(sum / N) -
            20 * std::exp(T(-0.2) * std::sqrt(sqsum / N));
   } else {
-    vsimd_type<T, W> sum(0);
-    vsimd_type<T, W> sqsum(0);
-    constexpr int RN = N & (-W);
-    for (int i = 0; i < RN; i += W) {
-      vsimd_type<T, W> tmp;
-      tmp.load(x + i);
-      sum += cospi(2 * tmp);
-      sqsum += tmp * tmp;
-    }
-    if constexpr (RN < N) {
-      vsimd_type<T, W> tmp;
-      tmp.load_partial(N - RN, x + RN);
-      sum += cospi(2 * tmp);
-      sqsum += tmp * tmp;
-    }
-    T sq = horizontal_add(sqsum);
-    T s = horizontal_add(sum);
-    if constexpr (RN < N) {
-      s -= (W - (N - RN));
-    }
-    return 20 + std::numbers::e_v<T> - std::exp(s / N) -
-           20 * std::exp(T(-0.2) * std::sqrt(sq / T(N)));
+    return kernels::ackley<vsimd_type<T, W>>(x, N);
   }
 }
 
@@ -111,42 +76,23 @@ inline auto elliptic(const T *x) noexcept {
     }
     return sum;
   } else {
-    constexpr auto ite = [] {
-      std::array<T, W> tmp{};
-      std::iota(tmp.begin(), tmp.end(), T(0));
-      return tmp;
-    }();
-    constexpr int RN = N & (-W);
-    vsimd_type<T, W> v(0);
-    for (int i = 0; i < RN; i += W) {
-      vsimd_type<T, W> tmp;
-      vsimd_type<T, W> tmp1;
-      tmp1.load(ite.data());
-      tmp1 += T(i);
-      tmp.load(x + i);
-      v += square(tmp) * pow(vsimd_type<T, W>(10), 6 * tmp1 / T(N - 1));
-    }
-    if constexpr (RN < N) {
-      vsimd_type<T, W> remain;
-      vsimd_type<T, W> tmp1;
-      remain.load_partial(N - RN, x + RN);
-      tmp1.load(ite.data());
-      tmp1 += RN;
-      v += square(remain) * pow(vsimd_type<T, W>(10), 6 * tmp1 / T(N - 1));
-    }
-    return horizontal_add(v);
+    return kernels::elliptic<vsimd_type<T, W>>(x, N);
   }
 }
 
 template <bool Using_SIMD, int N, int W, std::floating_point T>
 inline auto schwefel_1(const T *x) noexcept {
-  T sum(0);
-  T s1(0);
-  for (int i = 0; i < N; i++) {
-    s1 += x[i];
-    sum += s1 * s1;
+  if constexpr (!Using_SIMD) {
+    T sum(0);
+    T s1(0);
+    for (int i = 0; i < N; i++) {
+      s1 += x[i];
+      sum += s1 * s1;
+    }
+    return sum;
+  } else {
+    return kernels::schwefel_1<vsimd_type<T, W>>(x, N);
   }
-  return sum;
 }
 
 } // namespace sevobench::problem::simd
\ No newline at end of file
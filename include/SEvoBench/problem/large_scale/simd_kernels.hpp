@@ -0,0 +1,126 @@
+#pragma once
+#include "simd_type.hpp"
+#include "../../version2/vectormath_exp.h"
+#include "../../version2/vectormath_trig.h"
+#include <numbers>
+
+// Runtime-length kernels templated on the vector type V. They only depend on
+// V and on each other, so the same source can be compiled once per
+// instruction set (see problem/dispatch) without the per-ISA copies sharing
+// any symbol with the rest of the program.
+namespace sevobench::problem::simd::kernels {
+
+template <typename V> using scalar_t = std::remove_cvref_t<decltype(V()[0])>;
+
+template <typename V> inline V lane_index() noexcept {
+  using T = scalar_t<V>;
+  T idx[V::size()];
+  for (int i = 0; i < V::size(); i++)
+    idx[i] = T(i);
+  V v;
+  v.load(idx);
+  return v;
+}
+
+template <typename V> inline V load(const scalar_t<V> *x, int k) noexcept {
+  V v;
+  if (k == V::size())
+    v.load(x);
+  else
+    v.load_partial(k, x);
+  return v;
+}
+
+// Calls f(i, k, m) for every block of k <= W lanes starting at i; m masks
+// the zero-padded lanes of the tail block.
+template <typename V> inline void for_blocks(int n, auto &&f) noexcept {
+  constexpr int W = V::size();
+  const auto all = V(0) == V(0);
+  int i = 0;
+  for (; i + W <= n; i += W)
+    f(i, W, all);
+  if (i < n)
+    f(i, n - i, lane_index<V>() < scalar_t<V>(n - i));
+}
+
+template <typename V> inline auto horizontal_mul(V v) noexcept {
+  scalar_t<V> a[V::size()];
+  v.store(a);
+  scalar_t<V> r(1);
+  for (int i = 0; i < V::size(); i++)
+    r *= a[i];
+  return r;
+}
+
+template <typename V>
+inline auto sphere(const scalar_t<V> *x, int n) noexcept {
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto t = load<V>(x + i, k);
+    v += t * t;
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto elliptic(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    auto e = 6 * (lane_index<V>() + T(i)) / T(n - 1);
+    v += square(load<V>(x + i, k)) * pow(V(10), e);
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto rastrigin(const scalar_t<V> *x, int n) noexcept {
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto t = load<V>(x + i, k);
+    v = if_add(m, v, t * t - 10 * cospi(2 * t));
+  });
+  return 10 * n + horizontal_add(v);
+}
+
+template <typename V>
+inline auto ackley(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  V sum(0), sqsum(0);
+  for_blocks<V>(n, [&](int i, int k, auto m) {
+    auto t = load<V>(x + i, k);
+    sum = if_add(m, sum, cospi(2 * t));
+    sqsum += t * t;
+  });
+  return 20 + std::numbers::e_v<T> - std::exp(horizontal_add(sum) / n) -
+         20 * std::exp(T(-0.2) * std::sqrt(horizontal_add(sqsum) / T(n)));
+}
+
+template <typename V>
+inline auto rosenbrock(const scalar_t<V> *x, int n) noexcept {
+  V v(0);
+  for_blocks<V>(n - 1, [&](int i, int k, auto) {
+    auto a = load<V>(x + i, k);
+    auto b = load<V>(x + i + 1, k);
+    v += a * a + 100 * square(b + 1 - square(a + 1));
+  });
+  return horizontal_add(v);
+}
+
+template <typename V>
+inline auto schwefel_1(const scalar_t<V> *x, int n) noexcept {
+  using T = scalar_t<V>;
+  T s(0);
+  V v(0);
+  for_blocks<V>(n, [&](int i, int k, auto) {
+    T buf[V::size()] = {};
+    for (int j = 0; j < k; j++)
+      buf[j] = s += x[i + j];
+    V t;
+    t.load(buf);
+    v += t * t;
+  });
+  return horizontal_add(v);
+}
+
+} // namespace sevobench::problem::simd::kernels
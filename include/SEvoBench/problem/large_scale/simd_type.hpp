@@ -16,12 +16,27 @@
 // simulate header included
 #define __X86INTRIN_H
 #endif
-// finally include vectorclass
+// finally include vectorclass; GCC reports the undefined first operand of
+// some AVX-512 intrinsics it inlines as uninitialized.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
 #include "../../version2/vectorclass.h"
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
 #include <concepts>
 #include <tuple>
 #include <type_traits>
 
+#ifdef VCL_NAMESPACE
+namespace sevobench::problem {
+using namespace VCL_NAMESPACE;
+}
+#endif
+
 namespace sevobench::problem {
 constexpr auto simd_id() {
 #ifdef INSTRSET
@@ -3,14 +3,27 @@
 #include "../common/tool.hpp"
 namespace sevobench::problem {
 
+// Dim of problems whose dimension is given at construction instead.
+inline constexpr int runtime_dim = 0;
+
 template <int Index, int Dim, std::floating_point T>
-  requires(Index > 0) && (Dim > 0)
+  requires(Index > 0) && (Dim >= 0)
 struct problem_common {
   using value_type = T;
   constexpr static auto index() { return Index; }
   constexpr static auto dim() { return Dim; }
 };
 
+template <int Index, std::floating_point T>
+struct problem_common<Index, runtime_dim, T> {
+  using value_type = T;
+  constexpr static auto index() { return Index; }
+  auto dim() const noexcept { return dim_; }
+
+protected:
+  int dim_ = 0;
+};
+
 template <std::floating_point T> struct problem_info {
   int index;
   int instance;
@@ -35,11 +48,36 @@ inline auto problem_range() noexcept {
   return v;
 }
 
+// Whether a problem family has Problem<Index, runtime_dim, T>, taking the
+// dimension as its first constructor argument. Families specialize it.
+template <template <int, int, typename> class Problem>
+inline constexpr bool has_runtime_dim = false;
+
+// Whether X holds n rows of dim values starting stride apart, and out n
+// values, as evaluate_batch requires.
+template <typename T>
+inline bool batch_fits(std::span<const T> X, int n, std::size_t stride,
+                       int dim, std::span<T> out) noexcept {
+  const auto d = static_cast<std::size_t>(dim);
+  return n <= 0 || (stride >= d && out.size() >= std::size_t(n) &&
+                    X.size() >= (n - 1) * stride + d);
+}
+
 template <std::floating_point T> class single_problem {
   problem_info<T> problem_data_;
 
 public:
   virtual T operator()(std::span<const T>) = 0;
+  // Evaluates the n rows of X that start stride apart into out, or returns
+  // false without evaluating any if they do not fit (see batch_fits).
+  virtual bool evaluate_batch(std::span<const T> X, int n, std::size_t stride,
+                              std::span<T> out) {
+    if (!batch_fits(X, n, stride, dim(), out))
+      return false;
+    for (int r = 0; r < n; r++)
+      out[r] = (*this)(X.subspan(r * stride, dim()));
+    return true;
+  }
   virtual ~single_problem() = default;
   auto index() { return problem_data_.index; }
   auto instance() { return problem_data_.instance; }
@@ -93,8 +131,41 @@ public:
       : single_problem<value_type>(_f.problem_information()), f(std::move(_f)) {
   }
   value_type operator()(std::span<const value_type> x) override { return f(x); }
+  bool evaluate_batch(std::span<const value_type> X, int n,
+                      std::size_t stride, std::span<value_type> out) override {
+    if constexpr (requires { f.evaluate_batch(X, n, stride, out); }) {
+      return f.evaluate_batch(X, n, stride, out);
+    } else {
+      if (!batch_fits(X, n, stride, this->dim(), out))
+        return false;
+      for (int r = 0; r < n; r++)
+        out[r] = f(X.subspan(r * stride, this->dim()));
+      return true;
+    }
+  }
 };
 
+// Problem<I, Dim, T> constructed from arg, preceded by the dimension for
+// runtime_dim.
+template <typename P, int Dim, typename Arg>
+concept problem_constructible =
+    (Dim != runtime_dim && std::constructible_from<P, Arg>) ||
+    (Dim == runtime_dim && std::constructible_from<P, int, Arg>);
+
+template <template <int, int, typename> class Problem, int I, int Dim,
+          std::floating_point T, typename Arg>
+inline std::unique_ptr<single_problem<T>> make_problem(int dim,
+                                                       Arg arg) noexcept {
+  auto p = [&] {
+    if constexpr (Dim == runtime_dim)
+      return Problem<I, Dim, T>(dim, arg);
+    else
+      return Problem<I, Dim, T>(arg);
+  }();
+  return std::make_unique<single_problem_wrapper<Problem<I, Dim, T>>>(
+      std::move(p));
+}
+
 template <template <int, int, typename> class Problem, int Dim,
           std::floating_point T, int I = 1, int S = 0>
 inline constexpr auto get_problem_size() noexcept {
@@ -107,14 +178,10 @@ inline constexpr auto get_problem_size() noexcept {
 
 template <template <int, int, typename> class Problem, int Dim,
           std::floating_point T, typename Arg, int I, int L>
-  requires(L > 0) && requires(Arg arg) { Problem<I, Dim, T>(arg); }
+  requires(L > 0) && problem_constructible<Problem<I, Dim, T>, Dim, Arg>
 inline auto generate_problem_factory(auto &v) noexcept {
   if constexpr (I <= L) {
-    v.emplace_back([](Arg arg) {
-      return std::unique_ptr<single_problem<T>>(
-          std::make_unique<single_problem_wrapper<Problem<I, Dim, T>>>(
-              Problem<I, Dim, T>(arg)));
-    });
+    v.emplace_back(make_problem<Problem, I, Dim, T, Arg>);
     if constexpr (I <= L - 1)
       generate_problem_factory<Problem, Dim, T, Arg, I + 1, L>(v);
   }
@@ -124,7 +191,7 @@ template <template <int, int, typename> class Problem, int Dim,
           std::floating_point T, typename Arg>
 inline auto generate_problem_factory() noexcept {
   constexpr auto size = get_problem_size<Problem, Dim, T>();
-  std::vector<std::unique_ptr<single_problem<T>> (*)(Arg)> v;
+  std::vector<std::unique_ptr<single_problem<T>> (*)(int, Arg)> v;
   v.reserve(size);
   generate_problem_factory<Problem, Dim, T, Arg, 1,
                            get_problem_size<Problem, Dim, T>()>(v);
@@ -149,7 +216,9 @@ inline auto filter_problem_indexs(std::vector<int> v) noexcept {
 template <template <int, int, typename> class Problem, int Dim,
           std::floating_point T, typename Arg>
   requires requires { generate_problem_factory<Problem, Dim, T, Arg>(); }
-inline auto create_problems(std::vector<int> arg1, Arg arg2) noexcept {
+inline auto create_problems(std::vector<int> arg1, Arg arg2,
+                            std::optional<std::uint64_t> seed = std::nullopt,
+                            int dim = Dim) noexcept {
   std::vector<std::unique_ptr<single_problem<T>>> result;
   auto table = generate_problem_factory<Problem, Dim, T, Arg>();
   auto v = filter_problem_indexs<Problem, Dim, T>(arg1);
@@ -164,16 +233,62 @@ inline auto create_problems(std::vector<int> arg1, Arg arg2) noexcept {
     }
     for (auto index : v) {
       if constexpr (!std::is_same_v<Arg, int>) {
-        result.emplace_back(table[index - 1](arg2));
+        result.emplace_back(table[index - 1](dim, arg2));
       } else {
-        for (int i = 1; i <= arg2; i++)
-          result.emplace_back(table[index - 1](i));
+        for (int i = 1; i <= arg2; i++) {
+          std::optional<tool::seed_scope> scope;
+          if (seed)
+            scope.emplace(*seed, index, i, 0);
+          result.emplace_back(table[index - 1](dim, i));
+        }
       }
     }
   }
   return result;
 }
 
+// A dimension of Problem at which problem indexes can be listed.
+template <template <int, int, typename> class Problem, int... Fast>
+inline constexpr int listing_dim() noexcept {
+  if constexpr (has_runtime_dim<Problem>) {
+    return runtime_dim;
+  } else {
+    static_assert(sizeof...(Fast) > 0, "NO RUNTIME DIM, LIST FIXED DIMS");
+    constexpr int dims[] = {Fast..., runtime_dim};
+    return dims[0];
+  }
+}
+
+// Whether Problem can be built at dimension dim: one of Fast, or any
+// positive dimension if the family has a runtime_dim form.
+template <template <int, int, typename> class Problem, int... Fast>
+inline constexpr bool supports_dim(int dim) noexcept {
+  return ((dim == Fast) || ...) || (has_runtime_dim<Problem> && dim > 0);
+}
+
+// Problems of dimension dim: Problem<I, D, T> for the D of Fast equal to
+// dim, else Problem<I, runtime_dim, T>. None if !supports_dim(dim).
+template <template <int, int, typename> class Problem, std::floating_point T,
+          int... Fast, typename Arg>
+inline auto
+create_runtime_problems(std::integer_sequence<int, Fast...>, int dim,
+                        std::vector<int> arg1, Arg arg2,
+                        std::optional<std::uint64_t> seed) noexcept {
+  std::vector<std::unique_ptr<single_problem<T>>> result;
+  if (!supports_dim<Problem, Fast...>(dim))
+    return result;
+  const bool fixed =
+      ((dim == Fast &&
+        (result = create_problems<Problem, Fast, T>(arg1, arg2, seed), true)) ||
+       ...);
+  if constexpr (has_runtime_dim<Problem>) {
+    if (!fixed)
+      result = create_problems<Problem, runtime_dim, T>(std::move(arg1), arg2,
+                                                        seed, dim);
+  }
+  return result;
+}
+
 } // namespace detail
 
 } // namespace sevobench::problem
@@ -4,6 +4,8 @@
 #include "problem.hpp"
 namespace sevobench::problem {
 
+// With Dim = runtime_dim the dimension is a constructor argument, see
+// suite_builder::dim(int).
 template <template <int, int, typename> class Problem, int Dim,
           std::floating_point T>
 class suite {
@@ -11,25 +13,57 @@ private:
   std::vector<std::unique_ptr<single_problem<T>>> problems;
   std::vector<int> prob_ids;
   int ins_count = 0;
+  int dim_ = Dim;
+  bool valid_ = true;
+
+  static auto instances(auto arg2) noexcept {
+    if constexpr (std::is_same_v<decltype(arg2), int>)
+      return std::max(arg2, 1);
+    else
+      return 1;
+  }
 
 public:
   using value_type = T;
-  static constexpr auto dim() { return Dim; }
+  static constexpr auto dim()
+    requires(Dim != runtime_dim)
+  {
+    return Dim;
+  }
+  auto dim() const noexcept
+    requires(Dim == runtime_dim)
+  {
+    return dim_;
+  }
   auto begin() const { return problems.begin(); }
   auto end() const { return problems.end(); }
   auto size() const { return static_cast<int>(problems.size()); }
   auto instance_count() const { return ins_count; }
+  // False if the suite was built at a dimension the family does not
+  // support, in which case it holds no problems.
+  auto valid() const noexcept { return valid_; }
   auto problem_index() const { return prob_ids; }
   template <typename Arg>
-  suite(std::vector<int> arg1, Arg arg2)
-      : problems(detail::create_problems<Problem, Dim, T>(arg1, arg2)),
+  suite(std::vector<int> arg1, Arg arg2,
+        std::optional<std::uint64_t> seed = std::nullopt)
+      : problems(detail::create_problems<Problem, Dim, T>(arg1, arg2, seed)),
         prob_ids(detail::filter_problem_indexs<Problem, Dim, T>(arg1)),
-        ins_count([&] {
-          if constexpr (std::is_same_v<Arg, int>) {
-            return std::max(arg2, 1);
-          } else
-            return 1;
-        }()) {}
+        ins_count(instances(arg2)) {}
+  // Problems of dimension dim, built as Problem<I, D, T> if dim is one of
+  // the fixed dimensions D..., and as Problem<I, runtime_dim, T> otherwise.
+  template <typename Arg, int... D>
+    requires(Dim == runtime_dim)
+  suite(std::integer_sequence<int, D...> fixed, int dim, std::vector<int> arg1,
+        Arg arg2, std::optional<std::uint64_t> seed = std::nullopt)
+      : problems(detail::create_runtime_problems<Problem, T>(fixed, dim, arg1,
+                                                             arg2, seed)),
+        prob_ids(detail::filter_problem_indexs<
+                 Problem, detail::listing_dim<Problem, D...>(), T>(arg1)),
+        ins_count(instances(arg2)), dim_(dim),
+        valid_(detail::supports_dim<Problem, D...>(dim)) {
+    if (problems.empty())
+      prob_ids.clear();
+  }
 };
 
 namespace detail {
@@ -37,12 +71,15 @@ struct suite_args {
   std::vector<int> arg1;
   std::string dir_name;
   int ins_count;
+  std::optional<std::uint64_t> seed;
+  int dim = 0;
 };
 } // namespace detail
 
 template <template <int, int, typename> class Problem, int Dim = 0,
           std::floating_point T = float, bool B2 = false, bool B3 = true,
-          bool B4 = false, bool B5 = false, bool B6 = false>
+          bool B4 = false, bool B5 = false, bool B6 = false,
+          typename Fixed = std::integer_sequence<int>>
 class suite_builder {
   detail::suite_args args;
 
@@ -53,23 +90,35 @@ public:
   template <int N> auto dim() {
     return suite_builder<Problem, N, T, true, B3, B4, B5, B6>(std::move(args));
   }
+  // Dimension known at run time, e.g. read from a config file. Dimensions
+  // listed in D... are built as fixed-dimension problems, any other as
+  // runtime_dim ones; dim(n) alone instantiates each problem only once.
+  template <int... D> auto dim(int n) {
+    args.dim = n;
+    return suite_builder<Problem, runtime_dim, T, true, B3, B4, B5, B6,
+                         std::integer_sequence<int, D...>>(std::move(args));
+  }
   template <std::floating_point T1> auto type() {
-    return suite_builder<Problem, Dim, T1, B2, true, B4, B5, B6>(
+    return suite_builder<Problem, Dim, T1, B2, true, B4, B5, B6, Fixed>(
         std::move(args));
   }
   auto dir(std::string dir) {
     args.dir_name = std::move(dir);
-    return suite_builder<Problem, Dim, T, B2, B3, B4, true, false>(
+    return suite_builder<Problem, Dim, T, B2, B3, B4, true, false, Fixed>(
         std::move(args));
   }
   auto instance_count(int count) {
     args.ins_count = count;
-    return suite_builder<Problem, Dim, T, B2, B3, B4, false, true>(
+    return suite_builder<Problem, Dim, T, B2, B3, B4, false, true, Fixed>(
         std::move(args));
   }
+  auto seed(std::uint64_t master_seed) {
+    args.seed = master_seed;
+    return std::move(*this);
+  }
   auto problem_index(std::vector<int> prob_ids) {
     args.arg1 = std::move(prob_ids);
-    return suite_builder<Problem, Dim, T, B2, B3, true, B5, B6>(
+    return suite_builder<Problem, Dim, T, B2, B3, true, B5, B6, Fixed>(
         std::move(args));
   }
   auto build() {
@@ -77,11 +126,20 @@ public:
     static_assert(B3, "NO SET TYPE");
     static_assert(B4, "NO SET PROBLEM INDEXS");
     static_assert(B5 || B6, "NO SET INSTANCE COUNT/DIR");
-    if constexpr (B5) {
+    if constexpr (Dim == runtime_dim) {
+      if constexpr (B5) {
+        return suite<Problem, Dim, T>(Fixed{}, args.dim, std::move(args.arg1),
+                                      std::move(args.dir_name));
+      } else {
+        return suite<Problem, Dim, T>(Fixed{}, args.dim, std::move(args.arg1),
+                                      args.ins_count, args.seed);
+      }
+    } else if constexpr (B5) {
       return suite<Problem, Dim, T>(std::move(args.arg1),
                                     std::move(args.dir_name));
     } else {
-      return suite<Problem, Dim, T>(std::move(args.arg1), args.ins_count);
+      return suite<Problem, Dim, T>(std::move(args.arg1), args.ins_count,
+                                    args.seed);
     }
   }
 };
@@ -1,5 +1,6 @@
 #pragma once
 #include "./algorithm/de_module/de_algorithm.hpp"
+#include "./algorithm/island_module/island_model.hpp"
 #include "./algorithm/other_algorithm/single_algorithm.hpp"
 #include "./algorithm/pso_module/pso_algorithm.hpp"
 #include "./problem/cec/cec2014.hpp"
@@ -8,4 +9,7 @@
 #include "./problem/cec/cec2022.hpp"
 #include "./problem/suite.hpp"
 // #include"./problem/large_scale/cec2010.hpp"
-#include "./experiment/best_so_far_record.hpp"
\ No newline at end of file
+#include "./experiment/best_so_far_record.hpp"
+#include "./experiment/observer_pipeline.hpp"
+#include "./experiment/runtime_profile.hpp"
+#include "./experiment/trace_stream.hpp"
\ No newline at end of file
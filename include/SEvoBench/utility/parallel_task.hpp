@@ -1,9 +1,12 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <type_traits>
 #include <utility>
@@ -39,23 +42,32 @@ public:
     return *this;
   }
 };
-template <typename T> class threadsafe_queue {
+template <typename T> class work_stealing_queue {
   std::mutex mut;
   std::deque<T> data_queue;
-  std::condition_variable data_cond;
 
 public:
   void push(T new_value) noexcept {
-    {
-      std::lock_guard<std::mutex> lck(mut);
-      data_queue.push_back(std::move(new_value));
-    }
-    data_cond.notify_one();
+    std::lock_guard<std::mutex> lck(mut);
+    data_queue.push_back(std::move(new_value));
   }
   bool try_pop(T &value) noexcept {
     std::lock_guard<std::mutex> lck(mut);
     if (data_queue.empty())
       return false;
+    value = std::move(data_queue.back());
+    data_queue.pop_back();
+    return true;
+  }
+  // Without wait, gives up when the owner holds the queue.
+  bool try_steal(T &value, bool wait = false) noexcept {
+    std::unique_lock<std::mutex> lck(mut, std::defer_lock);
+    if (wait)
+      lck.lock();
+    else
+      lck.try_lock();
+    if (!lck || data_queue.empty())
+      return false;
     value = std::move(data_queue.front());
     data_queue.pop_front();
     return true;
@@ -64,30 +76,63 @@ public:
 } // namespace parallel_task_detail
 
 class parallel_task {
-
+  using task_type = parallel_task_detail::task_function_wrapper;
+  using queue_type = parallel_task_detail::work_stealing_queue<task_type>;
+  std::vector<std::unique_ptr<queue_type>> queues;
   std::vector<std::thread> ts;
-  parallel_task_detail::threadsafe_queue<
-      parallel_task_detail::task_function_wrapper>
-      tasks;
-  bool done;
-  void work_thread() noexcept {
-    while (!done) {
-      parallel_task_detail::task_function_wrapper task;
-      if (tasks.try_pop(task)) {
+  std::mutex park_mut;
+  std::condition_variable park_cond;
+  std::atomic<std::size_t> pending{0};
+  // Bumped under park_mut after every push, so that a worker parks only if
+  // nothing was pushed since its last full scan.
+  std::atomic<std::size_t> pushes{0};
+  std::atomic<unsigned int> next_queue{0};
+  std::atomic<bool> done{false};
+  static inline thread_local parallel_task *current_pool = nullptr;
+  static inline thread_local unsigned int current_index = 0;
+
+  bool find_task(unsigned int index, task_type &task, bool wait) noexcept {
+    if (queues[index]->try_pop(task))
+      return true;
+    const auto sz = static_cast<unsigned int>(queues.size());
+    for (unsigned int i = 1; i < sz; i++)
+      if (queues[(index + i) % sz]->try_steal(task, wait))
+        return true;
+    return false;
+  }
+  void work_thread(unsigned int index) noexcept {
+    current_pool = this;
+    current_index = index;
+    for (;;) {
+      const auto seen = pushes.load();
+      task_type task;
+      // A steal that lost the lock race is retried once with the lock
+      // taken; only then does the worker park.
+      if (find_task(index, task, false) || find_task(index, task, true)) {
+        pending.fetch_sub(1, std::memory_order_relaxed);
         task();
-      } else {
-        std::this_thread::yield();
+        continue;
       }
+      std::unique_lock<std::mutex> lck(park_mut);
+      park_cond.wait(lck,
+                     [&] { return done.load() || pushes.load() != seen; });
+      if (done.load() && pending.load() == 0)
+        return;
     }
   }
 
 public:
-  parallel_task(unsigned int _sz) : done(false) {
+  parallel_task(unsigned int _sz) {
+    _sz = std::max(_sz, 1u);
+    queues.reserve(_sz);
+    for (unsigned int i = 0; i < _sz; i++)
+      queues.emplace_back(std::make_unique<queue_type>());
     ts.reserve(_sz);
     for (unsigned int i = 0; i < _sz; i++)
-      ts.emplace_back(&parallel_task::work_thread, this);
+      ts.emplace_back(&parallel_task::work_thread, this, i);
   }
   parallel_task() : parallel_task(std::thread::hardware_concurrency()) {}
+  auto size() const noexcept { return static_cast<unsigned int>(ts.size()); }
   template <class Function, class... Args>
   [[nodiscard]] std::future<std::invoke_result_t<Function, Args...>>
   submit(Function &&f, Args &&...args) noexcept {
@@ -96,11 +141,28 @@ public:
     auto pt(std::packaged_task<std::invoke_result_t<Function, Args...>()>(
         std::move(g)));
     auto res = pt.get_future();
-    tasks.push(std::move(pt));
+    const auto index =
+        current_pool == this
+            ? current_index
+            : next_queue.fetch_add(1, std::memory_order_relaxed) %
+                  static_cast<unsigned int>(queues.size());
+    // Counted before the push, so that the worker taking the task never
+    // sees pending at zero.
+    pending.fetch_add(1);
+    queues[index]->push(std::move(pt));
+    {
+      std::lock_guard<std::mutex> lck(park_mut);
+      pushes.fetch_add(1);
+    }
+    park_cond.notify_one();
     return res;
   }
   ~parallel_task() noexcept {
-    done = true;
+    {
+      std::lock_guard<std::mutex> lck(park_mut);
+      done = true;
+    }
+    park_cond.notify_all();
     for (auto &_ : ts)
       if (_.joinable())
         _.join();
@@ -0,0 +1,25 @@
+# cmake -DNM=<nm> -DOBJECTS=<a|b|...> -P check_kernel_symbols.cmake
+#
+# Fails if a per-ISA kernel object defines a weak symbol outside its
+# sevobench_vcl_* namespace: the linker could then pick that copy, compiled
+# for a wider instruction set, for the whole program.
+string(REPLACE "|" ";" objects "${OBJECTS}")
+foreach(obj ${objects})
+  if(NOT obj MATCHES "kernel_(sse42|avx2|avx512)\\.cpp")
+    continue()
+  endif()
+  execute_process(COMMAND "${NM}" --defined-only "${obj}"
+                  OUTPUT_VARIABLE symbols RESULT_VARIABLE rc)
+  if(NOT rc EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${obj}")
+  endif()
+  string(REPLACE "\n" ";" symbols "${symbols}")
+  foreach(line ${symbols})
+    if(line MATCHES " [VWu] (.*)$")
+      set(name "${CMAKE_MATCH_1}")
+      if(NOT name MATCHES "sevobench_vcl_|^DW\\.ref\\.")
+        message(SEND_ERROR "weak symbol ${name} in ${obj}")
+      endif()
+    endif()
+  endforeach()
+endforeach()
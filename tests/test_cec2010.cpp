@@ -20,6 +20,18 @@ int main() {
                    .dim<Dim>()
                    .problem_index(problem::problem_range<1, 20>())
                    .build();
+  auto unlisted =
+      problem::suite_builder<
+          problem::simd::cec2010_setting<Group, Using_SIMD>::cec2010>()
+          .type<T>()
+          .instance_count(1)
+          .dim<Dim>(Dim / 2)
+          .problem_index({1})
+          .build();
+  if (unlisted.valid() || unlisted.size() != 0) {
+    std::printf("unlisted dimension suite is wrong\n");
+    return -1;
+  }
   sevobench::experiment::best_so_far_record<T> logger(suite, MaxFES, Runs,
                                                       Step);
   auto t0 = std::chrono::steady_clock::now();
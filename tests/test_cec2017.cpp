@@ -7,9 +7,29 @@ void cec17_test_func(double *, double *, int, int, int);
 double *OShift, *M, *y, *z, *x_bound;
 int ini_flag = 0, n_flag, func_flag, *SS;
 
+template <int Dim> struct cec2017_probe : sevobench::problem::cec2017<22, Dim, float> {
+  using sevobench::problem::cec2017<22, Dim, float>::cec2017;
+  auto tables() const noexcept {
+    return std::array<const void *, 2>{this->shift.data(), this->matrix.data()};
+  }
+};
+
 int main() {
   using namespace sevobench;
   constexpr int Dim = 30;
+  {
+    cec2017_probe<Dim> p1(1);
+    auto p2 = p1;
+    for (auto ptr : p1.tables())
+      if (reinterpret_cast<std::uintptr_t>(ptr) % tool::cache_line_size != 0) {
+        printf("problem data is not aligned\n");
+        return -1;
+      }
+    if (p1.tables() != p2.tables()) {
+      printf("problem copy duplicated its data\n");
+      return -1;
+    }
+  }
   std::array<double, Dim> time{};
   std::array<double, Dim> time1{};
   std::array<double, Dim> f1{};
@@ -32,6 +52,98 @@ int main() {
       time[i++] = (t2 - t1).count();
     }
   }
+  {
+    auto suites = problem::suite_builder<problem::cec2017>()
+                      .type<double>()
+                      .dir(DATA_DIR "/cec2017_data/")
+                      .dim<Dim>()
+                      .problem_index(problem::problem_range<1, 30>())
+                      .build();
+    // Rows padded to a wider stride, with slack after the last one.
+    constexpr std::size_t stride = Dim + 3;
+    std::vector<double> X(pop.pop_size() * stride + 5), out(pop.pop_size());
+    for (int k = 0; k < pop.pop_size(); k++)
+      std::ranges::copy(pop[k], X.begin() + k * stride);
+    for (auto &p : suites) {
+      if (!p->evaluate_batch(X, pop.pop_size(), stride, out) ||
+          p->evaluate_batch(std::span<const double>(X).first(
+                                (pop.pop_size() - 1) * stride + Dim - 1),
+                            pop.pop_size(), stride, out)) {
+        printf("%d,batch size check is wrong\n", p->index());
+        return -1;
+      }
+      for (int k = 0; k < pop.pop_size(); k++)
+        if (std::abs(out[k] - (*p)(pop[k])) > 1e-8 * std::abs(out[k])) {
+          printf("%d,batch evaluation mismatch\n", p->index());
+          return -1;
+        }
+    }
+  }
+  {
+    auto fixed = problem::suite_builder<problem::cec2017>()
+                     .type<double>()
+                     .dir(DATA_DIR "/cec2017_data/")
+                     .dim<Dim>()
+                     .problem_index(problem::problem_range<1, 30>())
+                     .build();
+    auto runtime = problem::suite_builder<problem::cec2017>()
+                       .type<double>()
+                       .dir(DATA_DIR "/cec2017_data/")
+                       .dim(Dim)
+                       .problem_index(problem::problem_range<1, 30>())
+                       .build();
+    if (runtime.size() != fixed.size() || runtime.dim() != Dim) {
+      printf("runtime dimension suite size is wrong\n");
+      return -1;
+    }
+    std::vector<double> X, out(pop.pop_size());
+    for (const auto &x : pop)
+      X.insert(X.end(), x.begin(), x.end());
+    for (int i = 0; i < fixed.size(); i++) {
+      auto &p = *(fixed.begin() + i);
+      auto &q = *(runtime.begin() + i);
+      q->evaluate_batch(X, pop.pop_size(), Dim, out);
+      for (int k = 0; k < pop.pop_size(); k++) {
+        const auto f = (*p)(pop[k]);
+        if (std::abs(f - (*q)(pop[k])) > 1e-8 * std::abs(f) ||
+            std::abs(f - out[k]) > 1e-8 * std::abs(f)) {
+          printf("%d,runtime dimension mismatch\n", p->index());
+          return -1;
+        }
+      }
+    }
+  }
+  {
+    auto dispatched = problem::suite_builder<problem::cec2017>()
+                          .type<double>()
+                          .dir(DATA_DIR "/cec2017_data/")
+                          .dim<10, Dim>(Dim)
+                          .problem_index({1})
+                          .build();
+    using fixed_type = problem::detail::single_problem_wrapper<
+        problem::cec2017<1, Dim, double>>;
+    auto odd = problem::suite_builder<problem::cec2017>()
+                   .type<double>()
+                   .instance_count(1)
+                   .dim(Dim + 7)
+                   .problem_index(problem::problem_range<1, 30>())
+                   .build();
+    std::vector<double> x(Dim + 7, 1.0);
+    auto finite = [&](auto &p) { return (*p)(x) < 1e300; };
+    auto bad = problem::suite_builder<problem::cec2017>()
+                   .type<double>()
+                   .instance_count(1)
+                   .dim(0)
+                   .problem_index({1})
+                   .build();
+    if (!dynamic_cast<fixed_type *>(dispatched.begin()->get()) ||
+        odd.size() != 30 || !std::ranges::all_of(odd, finite) ||
+        !dispatched.valid() || !odd.valid() || bad.valid() ||
+        bad.size() != 0) {
+      printf("runtime dimension dispatch is wrong\n");
+      return -1;
+    }
+  }
   {
     tool::simple_rand sr{100};
     for (int i = 0; i < 30; i++) {
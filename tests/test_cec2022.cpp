@@ -1,5 +1,6 @@
 #include "SEvoBench/sevobench.hpp"
 #include <chrono>
+#include <filesystem>
 #include <iostream>
 
 void cec22_test_func(double *, double *, int, int, int);
@@ -32,6 +33,55 @@ int main() {
       time[i++] = (t2 - t1).count();
     }
   }
+  {
+    auto suites = problem::suite_builder<problem::cec2022>()
+                      .type<double>()
+                      .dir(DATA_DIR "/cec2022_data/")
+                      .dim<Dim>()
+                      .problem_index(problem::problem_range<1, 12>())
+                      .build();
+    std::vector<double> X, out(pop.pop_size());
+    for (const auto &x : pop)
+      X.insert(X.end(), x.begin(), x.end());
+    for (auto &p : suites) {
+      p->evaluate_batch(X, pop.pop_size(), Dim, out);
+      for (int k = 0; k < pop.pop_size(); k++)
+        if (std::abs(out[k] - (*p)(pop[k])) > 1e-8 * std::abs(out[k])) {
+          printf("%d,batch evaluation mismatch\n", p->index());
+          return -1;
+        }
+    }
+  }
+  {
+    namespace fs = std::filesystem;
+    auto tmp = fs::temp_directory_path() / "sevobench_cec2022_pack";
+    fs::remove_all(tmp);
+    fs::copy(DATA_DIR "/cec2022_data/", tmp);
+    if (!problem::cec_detail::pack_cec_data(tmp.string())) {
+      std::cout << "pack_cec_data is failed!\n";
+      return -1;
+    }
+    fs::remove_all(tmp / "shift_data_1.txt");
+    auto text = problem::suite_builder<problem::cec2022>()
+                    .type<double>()
+                    .dir(DATA_DIR "/cec2022_data/")
+                    .dim<Dim>()
+                    .problem_index(problem::problem_range<1, 12>())
+                    .build();
+    auto packed = problem::suite_builder<problem::cec2022>()
+                      .type<double>()
+                      .dir(tmp.string())
+                      .dim<Dim>()
+                      .problem_index(problem::problem_range<1, 12>())
+                      .build();
+    for (int i = 0; i < text.size(); i++)
+      for (auto &x : pop)
+        if ((*text.begin()[i])(x) != (*packed.begin()[i])(x)) {
+          std::cout << "packed cec data is failed!\n";
+          return -1;
+        }
+    fs::remove_all(tmp);
+  }
   {
     tool::simple_rand sr{100};
     for (int i = 0; i < 12; i++) {
@@ -150,7 +150,246 @@ template <std::floating_point T> void test_art_de() {
             << '\n';
 }
 
+// With F = 0 every mutation reproduces its base vector, which pins down the
+// base indices reported by the batched entry points.
+template <std::floating_point T> int test_batched_pipeline() {
+  using namespace sevobench::de_module;
+  constexpr int Pop_Size = 50;
+  constexpr int Dim = 37;
+  sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+  for (int i = 0; i < Pop_Size; i++)
+    pop[i].set_fitness(T(i % 7));
+  auto trial = pop;
+  std::vector<T> fs(Pop_Size, T(0));
+  std::vector<int> base(Pop_Size);
+  for (auto &[name, m] : generate_mutation<T>()) {
+    auto mutation = m();
+    mutation->prepare(pop);
+    mutation->mutate_all(trial, pop, fs, base);
+    for (int i = 0; i < Pop_Size; i++)
+      if (trial[i] != pop[base[i]])
+        return -1;
+  }
+  for (int i = 0; i < Pop_Size; i++)
+    for (auto &x : trial[i])
+      x *= T(3);
+  for (auto &[name, c] : generate_constriant<T>()) {
+    if (name == "resample")
+      continue;
+    auto repaired = trial;
+    c()->repair_all(repaired, T(-100), T(100), pop, base);
+    for (auto &x : repaired)
+      if (std::any_of(x.begin(), x.end(),
+                      [](auto v) { return v < T(-100) || v > T(100); }))
+        return -1;
+  }
+  binomial_crossover<T> crossover;
+  auto donor = trial;
+  crossover.crossover_all(donor, pop, std::vector<T>(Pop_Size, T(1)));
+  if (donor != trial)
+    return -1;
+  crossover.crossover_all(donor, pop, std::vector<T>(Pop_Size, T(0)));
+  for (int i = 0; i < Pop_Size; i++) {
+    int kept = 0;
+    for (int j = 0; j < Dim; j++)
+      kept += donor[i][j] != pop[i][j];
+    if (kept != 1)
+      return -1;
+  }
+  std::cout << "batched de pipeline is true!\n";
+  return 0;
+}
+
+// The static builder runs the same generation loop as the runtime one, so
+// with the same seeds one generation must give the same population (up to
+// the reassociation -ffast-math allows once the modules are inlined).
+template <std::floating_point T> int test_static_de() {
+  using namespace sevobench::de_module;
+  constexpr int Pop_Size = 60;
+  constexpr int Dim = 20;
+  auto dynamic_run = [&](int fes) {
+    sevobench::tool::seed_scope scope(7, 1, 1, 1);
+    sevobench::evolutionary_algorithm alg(fes);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    de_algorithm_builder<T>()
+        .parameter(std::make_unique<jade_parameter<T>>())
+        .mutation(std::make_unique<ttpb1_mutation<T>>())
+        .constraint_handler(std::make_unique<midpoint_target_repair<T>>())
+        .crossover(std::make_unique<binomial_crossover<T>>())
+        .population_strategy(
+            std::make_unique<linear_reduction<T>>(alg, 4, Pop_Size))
+        .archive(std::make_unique<fifo_archive<T>>())
+        .build()
+        .run(pop, real_func<Dim, T>, T(-100), T(100), alg);
+    return pop;
+  };
+  auto static_run = [&](int fes) {
+    sevobench::tool::seed_scope scope(7, 1, 1, 1);
+    sevobench::evolutionary_algorithm alg(fes);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    auto de = static_de_algorithm_builder<T>()
+                  .parameter(jade_parameter<T>())
+                  .mutation(ttpb1_mutation<T>())
+                  .constraint_handler(midpoint_target_repair<T>())
+                  .crossover(binomial_crossover<T>())
+                  .population_strategy(linear_reduction<T>(alg, 4, Pop_Size))
+                  .archive(fifo_archive<T>())
+                  .build();
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(de.mutation())>,
+                                 ttpb1_mutation<T>>);
+    de.run(pop, real_func<Dim, T>, T(-100), T(100), alg);
+    return pop;
+  };
+  auto p1 = dynamic_run(2 * Pop_Size);
+  auto p2 = static_run(2 * Pop_Size);
+  if (p1.pop_size() != p2.pop_size())
+    return -1;
+  for (int i = 0; i < p1.pop_size(); i++)
+    for (int j = 0; j < Dim; j++)
+      if (std::abs(p1[i][j] - p2[i][j]) > T(1e-3))
+        return -1;
+  auto best = [](const auto &pop) {
+    return std::min_element(pop.begin(), pop.end(), [](auto &x, auto &y) {
+             return x.fitness() < y.fitness();
+           })->fitness();
+  };
+  if (!(best(static_run(Dim * 2000)) < best(p2)))
+    return -1;
+  std::cout << "static de builder is true!\n";
+  return 0;
+}
+
+// Every evaluation done on the pool must be counted exactly once, with
+// archives and SHADE memories updated as results arrive.
+template <std::floating_point T> int test_async_de() {
+  using namespace sevobench::de_module;
+  constexpr int Pop_Size = 40;
+  constexpr int Dim = 10;
+  sevobench::parallel_task pool(4);
+  std::atomic<int> calls{0};
+  auto f = [&](std::span<const T> x) {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    return real_func<Dim, T>(x);
+  };
+  auto check = [&](auto &&de, int in_flight) {
+    calls = 0;
+    sevobench::evolutionary_algorithm alg(Dim * 2000);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    de.run_async(pop, f, T(-100), T(100), alg, pool, in_flight);
+    auto best = std::min_element(pop.begin(), pop.end(), [](auto &x, auto &y) {
+                  return x.fitness() < y.fitness();
+                })->fitness();
+    for (auto &x : pop)
+      if (std::abs(x.fitness() - real_func<Dim, T>(x)) >
+          T(1e-9) * (1 + std::abs(x.fitness())))
+        return false;
+    return calls == alg.current_fes() && alg.current_fes() >= alg.max_fes() &&
+           best < T(1e3);
+  };
+  auto shade = de_algorithm_builder<T>()
+                   .parameter(std::make_unique<shade_parameter<T>>())
+                   .mutation(std::make_unique<ttpb1_mutation<T>>())
+                   .constraint_handler(std::make_unique<projection_repair<T>>())
+                   .crossover(std::make_unique<binomial_crossover<T>>())
+                   .population_strategy(std::make_unique<de_population<T>>());
+  auto jade = static_de_algorithm_builder<T>()
+                  .parameter(jade_parameter<T>())
+                  .mutation(ttpb1_mutation<T>())
+                  .constraint_handler(midpoint_target_repair<T>())
+                  .crossover(binomial_crossover<T>())
+                  .population_strategy(de_population<T>())
+                  .archive(random_archive<T>())
+                  .build();
+  if (!check(shade.archive(std::make_unique<fifo_archive<T>>()).build(), 8) ||
+      !check(jade, 1) || !check(jade, Pop_Size * 2))
+    return -1;
+  std::cout << "async de is true!\n";
+  return 0;
+}
+
+// A run stopped and resumed from its checkpoint ends exactly where the
+// uninterrupted run does; a damaged checkpoint, or one saved by another
+// configuration, is ignored and the run starts over.
+template <std::floating_point T> int test_checkpoint_de() {
+  using namespace sevobench::de_module;
+  constexpr int Pop_Size = 30;
+  constexpr int Dim = 10;
+  const std::string path = "test_de_module.ckpt";
+  int calls = 0;
+  auto f = [&](std::span<const T> x) {
+    calls++;
+    return real_func<Dim, T>(x);
+  };
+  auto go = [&](int stop) {
+    sevobench::tool::seed_scope seeds(11, 1, 1, 1);
+    sevobench::checkpoint_scope scope(path, 7);
+    sevobench::evolutionary_algorithm alg(Dim * 1000);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    de_algorithm_builder<T>()
+        .parameter(std::make_unique<shade_parameter<T>>())
+        .mutation(std::make_unique<ttpb1_mutation<T>>())
+        .constraint_handler(std::make_unique<midpoint_target_repair<T>>())
+        .crossover(std::make_unique<binomial_crossover<T>>())
+        .population_strategy(
+            std::make_unique<linear_reduction<T>>(alg, 4, Pop_Size))
+        .archive(std::make_unique<random_archive<T>>())
+        .build()
+        .run(pop, f, T(-100), T(100), alg, [=](auto &, auto &a) {
+          return a.current_fes() < std::min(a.max_fes(), stop);
+        });
+    return std::pair(pop, alg.current_fes());
+  };
+  // No archive and other parameter memories: the checkpoint of go decodes
+  // partway before it is rejected.
+  auto go_jade = [&] {
+    sevobench::tool::seed_scope seeds(11, 1, 1, 1);
+    sevobench::checkpoint_scope scope(path, 7);
+    sevobench::evolutionary_algorithm alg(Dim * 1000);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    de_algorithm_builder<T>()
+        .parameter(std::make_unique<jade_parameter<T>>())
+        .mutation(std::make_unique<ttpb1_mutation<T>>())
+        .constraint_handler(std::make_unique<midpoint_target_repair<T>>())
+        .crossover(std::make_unique<binomial_crossover<T>>())
+        .population_strategy(std::make_unique<de_population<T>>())
+        .build()
+        .run(pop, f, T(-100), T(100), alg);
+    return std::pair(pop, alg.current_fes());
+  };
+  constexpr int whole = std::numeric_limits<int>::max();
+  std::remove(path.c_str());
+  auto full = go(whole);
+  std::remove(path.c_str());
+  const int full_calls = std::exchange(calls, 0);
+  go(Dim * 400);
+  auto resumed = go(whole);
+  const int resumed_calls = std::exchange(calls, 0);
+  go(Dim * 400);
+  if (auto *file = std::fopen(path.c_str(), "r+b")) {
+    std::fseek(file, 100, SEEK_SET);
+    std::fputc(0x5A, file);
+    std::fclose(file);
+  }
+  auto restarted = go(whole);
+  std::remove(path.c_str());
+  auto jade = go_jade();
+  std::remove(path.c_str());
+  go(Dim * 400);
+  auto mismatched = go_jade();
+  std::remove(path.c_str());
+  if (resumed != full || resumed_calls != full_calls || restarted != full ||
+      mismatched != jade)
+    return -1;
+  std::cout << "de checkpoint is true!\n";
+  return 0;
+}
+
 int main() {
+  if (test_async_de<double>() != 0 || test_checkpoint_de<double>() != 0)
+    return -1;
+  if (test_batched_pipeline<float>() != 0 ||
+      test_batched_pipeline<double>() != 0 || test_static_de<float>() != 0)
+    return -1;
   test_basic_de<float>();
   test_art_de<float>();
   return 0;
@@ -0,0 +1,87 @@
+#include "SEvoBench/problem/cec/cec_base_problem.hpp"
+#include "SEvoBench/problem/large_scale/cec2010.hpp"
+#include <iostream>
+#include <random>
+
+// Built for the baseline instruction set and linked with the kernels of
+// sevobench_add_kernel_dispatch(), so every call below goes through the
+// registry; long double never dispatches and serves as the reference.
+template <int Dim> bool test_kernels() {
+  using namespace sevobench::problem;
+  std::default_random_engine gen{Dim};
+  std::uniform_real_distribution<double> dis(-100, 100);
+  bool ok = true;
+  auto check = [&](const char *name, auto f, auto g) {
+    for (int r = 0; r < 20 && ok; r++) {
+      std::array<double, Dim> x;
+      std::array<long double, Dim> y;
+      for (int i = 0; i < Dim; i++)
+        y[i] = x[i] = dis(gen);
+      long double v1 = f(x);
+      long double v2 = g(y);
+      if (std::abs(v1 - v2) > 1e-8L * std::max(1.0L, std::abs(v2))) {
+        std::cout << name << " failed: " << double(v1) << "," << double(v2)
+                  << '\n';
+        ok = false;
+      }
+    }
+  };
+#define CHECK_CEC(F)                                                           \
+  check(                                                                       \
+      #F, [](auto &x) { return cec_detail::F<double, Dim>(x); },               \
+      [](auto &y) { return cec_detail::F<long double, Dim>(y); })
+  CHECK_CEC(zakharov_func);
+  CHECK_CEC(rosenbrock_func);
+  CHECK_CEC(escaffer6_func);
+  CHECK_CEC(rastrigin_func);
+  CHECK_CEC(levy_func);
+  CHECK_CEC(bent_cigar_func);
+  CHECK_CEC(hgbat_func);
+  CHECK_CEC(katsuura_func);
+  CHECK_CEC(ackley_func);
+  CHECK_CEC(schwefel_func);
+  CHECK_CEC(schwefel_F7_func);
+  CHECK_CEC(happycat_func);
+  CHECK_CEC(grie_rosen_func);
+  CHECK_CEC(griewank_func);
+  CHECK_CEC(ellips_func);
+  CHECK_CEC(discus_func);
+  CHECK_CEC(bi_rastrigin_func);
+  CHECK_CEC(weierstrass_func);
+#undef CHECK_CEC
+  const auto *k = dispatched_kernels<double>();
+  if (!k)
+    return ok;
+#define CHECK_LSGO(F)                                                          \
+  check(                                                                       \
+      #F, [&](auto &x) { return k->large_scale.F(x.data(), Dim); },            \
+      [](auto &y) { return simd::F<false, Dim, -1, long double>(y.data()); })
+  CHECK_LSGO(sphere);
+  CHECK_LSGO(elliptic);
+  CHECK_LSGO(rastrigin);
+  CHECK_LSGO(ackley);
+  CHECK_LSGO(rosenbrock);
+  CHECK_LSGO(schwefel_1);
+#undef CHECK_LSGO
+  return ok;
+}
+
+// Evaluated before the kernels of the other translation units register;
+// the problems must still pick them up afterwards.
+const bool early = [] {
+  std::array<double, 13> x{};
+  return sevobench::problem::cec_detail::zakharov_func<double, 13>(x) == 0;
+}();
+
+int main() {
+  using namespace sevobench::problem;
+  const auto *k = kernel_registry<double>::best();
+  std::cout << "dispatched level: "
+            << (k ? static_cast<int>(k->level) : -1) << '\n';
+  if (!early || k != dispatched_kernels<double>() ||
+      (k && kernel_registry<float>::best()->level != k->level))
+    return -1;
+  if (!test_kernels<13>() || !test_kernels<50>())
+    return -1;
+  std::cout << "dispatched kernels is true!\n";
+}
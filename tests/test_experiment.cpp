@@ -1,7 +1,481 @@
 #include "SEvoBench/sevobench.hpp"
 #include <chrono>
+#include <filesystem>
 #include <iostream>
-int main() {
+
+inline std::atomic<long> bench_evaluations{0};
+
+constexpr int bench_dim = 10;
+constexpr int bench_max_fes = 200 * bench_dim;
+
+auto seeded_suite(std::uint64_t seed) {
+  using namespace sevobench;
+  return problem::suite_builder<problem::cec2022>()
+      .type<float>()
+      .dim<bench_dim>()
+      .instance_count(2)
+      .seed(seed)
+      .problem_index(problem::problem_range<1, 12>())
+      .build();
+}
+
+// stop cuts every run short, as a preempted job would be.
+auto seeded_de(int stop = std::numeric_limits<int>::max()) {
+  return [=](auto &&f) {
+    using namespace sevobench;
+    using namespace sevobench::de_module;
+    using T = float;
+    evolutionary_algorithm alg(bench_max_fes);
+    population<T> pop(20, bench_dim, f.lower_bound(), f.upper_bound());
+    auto de = de_algorithm_builder<T>()
+                  .mutation(std::make_unique<rand1_mutation<T>>())
+                  .parameter(std::make_unique<jade_parameter<T>>())
+                  .crossover(std::make_unique<binomial_crossover<T>>())
+                  .constraint_handler(
+                      std::make_unique<midpoint_target_repair<T>>())
+                  .population_strategy(
+                      std::make_unique<linear_reduction<T>>(alg, 4, 20))
+                  .build();
+    auto counted = [&](std::span<const T> x) {
+      bench_evaluations++;
+      return f(x);
+    };
+    de.run(pop, counted, f.lower_bound(), f.upper_bound(), alg,
+           [=](auto &, auto &a) {
+             return a.current_fes() < std::min(a.max_fes(), stop);
+           });
+  };
+}
+
+auto seeded_bench(std::uint64_t seed,
+                  std::optional<std::string> checkpoint_dir = std::nullopt,
+                  int stop = std::numeric_limits<int>::max()) {
+  using namespace sevobench;
+  auto suite = seeded_suite(seed);
+  experiment::best_so_far_record<float> logger(suite, bench_max_fes, 3,
+                                               10 * bench_dim);
+  experiment::evo_bench<true>(
+      seeded_de(stop), suite, logger,
+      experiment::bench_config{.independent_runs = 3,
+                               .seed = seed,
+                               .checkpoint_dir = checkpoint_dir,
+                               .checkpoint_interval = 3});
+  auto b = logger.best();
+  return std::vector<float>(b.begin(), b.end());
+}
+
+int test_reproducible_bench() {
+  if (seeded_bench(2024) != seeded_bench(2024) ||
+      seeded_bench(2024) == seeded_bench(2025)) {
+    std::cout << "seeded evo_bench is failed!\n";
+    return -1;
+  }
+  std::cout << "seeded evo_bench is true!\n";
+  return 0;
+}
+
+// Runs resumed from their checkpoints report what uninterrupted runs do.
+int test_resumed_bench() {
+  auto dir = std::filesystem::temp_directory_path() / "sevobench_resume";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  bench_evaluations = 0;
+  auto full = seeded_bench(2024);
+  const long full_evaluations = bench_evaluations.exchange(0);
+  seeded_bench(2024, dir.string(), 700);
+  auto files = std::distance(std::filesystem::directory_iterator(dir),
+                             std::filesystem::directory_iterator());
+  const long preempted_evaluations = bench_evaluations.exchange(0);
+  auto resumed = seeded_bench(2024, dir.string());
+  std::filesystem::remove_all(dir);
+  if (files != 12 * 2 * 3 || resumed != full ||
+      preempted_evaluations + bench_evaluations != full_evaluations) {
+    std::cout << "resumed evo_bench is failed!\n";
+    return -1;
+  }
+  std::cout << "resumed evo_bench is true!\n";
+  return 0;
+}
+
+// An algorithm working on a copy of f still logs into its run.
+int test_copied_problem() {
+  using namespace sevobench;
+  auto suite = seeded_suite(2024);
+  experiment::best_so_far_record<float> logger(suite, bench_max_fes, 3,
+                                               10 * bench_dim);
+  experiment::evo_bench<true>(
+      [alg = seeded_de()](const auto &f) -> void {
+        auto copy = f;
+        alg(copy);
+      },
+      suite, logger,
+      experiment::bench_config{.independent_runs = 3,
+                               .seed = 2024,
+                               .checkpoint_dir = std::nullopt,
+                               .checkpoint_interval = 100});
+  if (!std::ranges::equal(logger.best(), seeded_bench(2024))) {
+    std::cout << "copied problem is failed!\n";
+    return -1;
+  }
+  std::cout << "copied problem is true!\n";
+  return 0;
+}
+
+// A streamed trace reads back as the trace best_so_far_record keeps, even
+// when runs are split over many blocks.
+int test_trace_stream() {
+  using namespace sevobench;
+  auto path = std::filesystem::temp_directory_path() / "sevobench_trace.bin";
+  auto suite = seeded_suite(2024);
+  experiment::best_so_far_record<float> logger(suite, bench_max_fes, 3, 7);
+  experiment::bench_config config{.independent_runs = 3,
+                                  .seed = 2024,
+                                  .checkpoint_dir = std::nullopt,
+                                  .checkpoint_interval = 100};
+  experiment::evo_bench<true>(seeded_de(), suite, logger, config);
+  {
+    experiment::trace_writer<float> writer(path.string(), bench_max_fes, 7,
+                                           16);
+    experiment::evo_bench<true>(seeded_de(), suite, writer, config);
+  }
+  experiment::trace_reader<float> reader(path.string());
+  auto runs = reader.read_all();
+  bool same = reader.good() && runs.size() == 12 * 2 * 3;
+  for (auto &[key, r] : runs) {
+    auto [index, instance, dim, run_id] = key;
+    const auto &trace = logger.at(index, instance)[run_id - 1];
+    same = same && dim == bench_dim && r.fes.size() == trace.size() &&
+           std::ranges::equal(r.fes, trace | std::views::keys) &&
+           std::ranges::equal(r.best, trace | std::views::values);
+  }
+  std::filesystem::remove(path);
+  if (!same) {
+    std::cout << "trace stream is failed!\n";
+    return -1;
+  }
+  std::cout << "trace stream is true!\n";
+  return 0;
+}
+
+// Traces of one problem and run at two dimensions read back as two runs,
+// although the D=30 run starts at a FES the D=10 run already passed.
+int test_trace_dims() {
+  using namespace sevobench;
+  auto path = std::filesystem::temp_directory_path() / "sevobench_dims.bin";
+  {
+    experiment::trace_writer<float> writer(path.string(), 100, 1, 4);
+    for (int dim : {10, 30}) {
+      auto r = writer.open_run({.index = 1,
+                                .instance = 1,
+                                .dim = dim,
+                                .lb = -100.0f,
+                                .ub = 100.0f,
+                                .optimum = std::nullopt},
+                               1);
+      for (int fes = 1; fes <= 10; fes++)
+        r.log({.evaluations = fes,
+               .run_id = 1,
+               .current_value = float(dim - fes),
+               .current_x = {}});
+      writer.close_run(r);
+    }
+  }
+  experiment::trace_reader<float> reader(path.string());
+  auto runs = reader.read_all();
+  std::filesystem::remove(path);
+  bool same = reader.good() && runs.size() == 2;
+  for (int dim : {10, 30}) {
+    auto it = runs.find({1, 1, dim, 1});
+    same = same && it != runs.end() && it->second.fes.size() == 10 &&
+           it->second.best.back() == float(dim - 10);
+  }
+  if (!same) {
+    std::cout << "trace dims is failed!\n";
+    return -1;
+  }
+  std::cout << "trace dims is true!\n";
+  return 0;
+}
+
+// A benchmark stopped, left with a torn block, and resumed in append mode
+// writes the traces an uninterrupted one does.
+int test_resumed_trace() {
+  using namespace sevobench;
+  namespace fs = std::filesystem;
+  auto dir = fs::temp_directory_path() / "sevobench_resume_trace";
+  fs::remove_all(dir);
+  fs::create_directories(dir);
+  const auto full_path = (dir / "full.bin").string();
+  const auto path = (dir / "resumed.bin").string();
+  auto suite = seeded_suite(2024);
+  auto bench = [&](const std::string &p, bool append, int stop, bool ckpt) {
+    experiment::trace_writer<float> writer(p, bench_max_fes, 7, 16, append);
+    experiment::evo_bench<true>(
+        seeded_de(stop), suite, writer,
+        experiment::bench_config{
+            .independent_runs = 3,
+            .seed = 2024,
+            .checkpoint_dir =
+                ckpt ? std::optional(dir.string()) : std::nullopt,
+            .checkpoint_interval = 3});
+  };
+  bench(full_path, false, std::numeric_limits<int>::max(), false);
+  bench(path, false, 700, true);
+  if (auto *f = std::fopen(path.c_str(), "ab")) {
+    std::fwrite("TBLK", 1, 4, f);
+    std::fclose(f);
+  }
+  bench(path, true, std::numeric_limits<int>::max(), true);
+  experiment::trace_reader<float> full(full_path), resumed(path);
+  auto a = full.read_all();
+  auto b = resumed.read_all();
+  bool same = full.good() && resumed.good() && a.size() == 12 * 2 * 3 &&
+              a.size() == b.size();
+  for (auto &[key, r] : a)
+    same = same && b.contains(key) && r.fes == b[key].fes &&
+           r.best == b[key].best;
+  fs::remove_all(dir);
+  if (!same) {
+    std::cout << "resumed trace is failed!\n";
+    return -1;
+  }
+  std::cout << "resumed trace is true!\n";
+  return 0;
+}
+
+// Every instance has one run reaching 10 at FES 20 and 1 at FES 30, and
+// one stuck at 100 until FES 30, all above a per-problem reference.
+int test_runtime_analysis() {
+  using namespace sevobench;
+  auto suite = seeded_suite(2024);
+  experiment::best_so_far_record<double> record(suite, 30, 2, 10);
+  auto reference = [](int index, int) { return index * 100.0; };
+  for (auto index : suite.problem_index())
+    for (int ins = 1; ins <= 2; ins++)
+      for (int run = 1; run <= 2; run++) {
+        auto r = record.open_run({.index = index,
+                                  .instance = ins,
+                                  .dim = bench_dim,
+                                  .lb = -100,
+                                  .ub = 100,
+                                  .optimum = std::nullopt},
+                                 run);
+        for (int fes = 1; fes <= 30; fes++) {
+          const double v = run == 2 || fes < 20 ? 100 : fes < 30 ? 10 : 1;
+          r.log({.evaluations = fes,
+                 .run_id = run,
+                 .current_value = v + reference(index, ins),
+                 .current_x = {}});
+        }
+        record.close_run(r);
+      }
+  auto check = [](const auto &p) {
+    constexpr double eps = 1e-12;
+    return p.ert.size() == 3 && std::abs(p.ert[0] - 50) < eps &&
+           std::abs(p.ert[1] - 60) < eps &&
+           p.ert[2] == std::numeric_limits<double>::max() &&
+           p.success_rate == std::vector<double>{0.5, 0.5, 0} &&
+           p.ecdf.size() == 3 && p.ecdf[0] == 0 &&
+           std::abs(p.ecdf[1] - 2.0 / 12) < eps &&
+           std::abs(p.ecdf[2] - 4.0 / 12) < eps &&
+           std::abs(p.auc - 0.5 / 3) < eps;
+  };
+  auto parallel = experiment::runtime_analysis(record, {1, 0.1, 10},
+                                               {30, 15, 25}, reference);
+  auto serial = experiment::runtime_analysis<false>(record, {1, 0.1, 10},
+                                                    {30, 15, 25}, reference);
+  bool same = parallel.problems.size() == 12 &&
+              parallel.ecdf.size() == 3 &&
+              std::abs(parallel.ecdf[2] - 4.0 / 12) < 1e-12 &&
+              parallel.targets == std::vector<double>{10, 1, 0.1} &&
+              parallel.budgets == std::vector<int>{15, 25, 30};
+  for (std::size_t i = 0; i < parallel.problems.size(); i++)
+    same = same && check(parallel.problems[i]) &&
+           parallel.problems[i].index == suite.problem_index()[i] &&
+           parallel.problems[i].ecdf == serial.problems[i].ecdf;
+  if (!same) {
+    std::cout << "runtime analysis is failed!\n";
+    return -1;
+  }
+  std::cout << "runtime analysis is true!\n";
+  return 0;
+}
+
+// Keeps what a pipeline stage saw, per run.
+struct stage_capture {
+  struct run_type {
+    int index = 0;
+    int instance = 0;
+    int run_id = 0;
+    std::vector<std::pair<int, float>> seen;
+    void log(const sevobench::problem::problem_state<float> &state) noexcept {
+      seen.emplace_back(state.evaluations, state.current_value);
+    }
+  };
+  std::mutex mut;
+  std::vector<run_type> runs;
+  auto open_run(const sevobench::problem::problem_info<float> &info,
+                int run_id) noexcept {
+    return run_type{.index = info.index,
+                    .instance = info.instance,
+                    .run_id = run_id,
+                    .seen = {}};
+  }
+  void close_run(run_type &r) noexcept {
+    std::lock_guard<std::mutex> lck(mut);
+    runs.push_back(std::move(r));
+  }
+};
+
+struct stage_counter final : sevobench::experiment::suite_observer<float> {
+  std::atomic<long> calls{0};
+  void log(const sevobench::problem::problem_state<float> &state,
+           const sevobench::problem::problem_info<float> &) override {
+    if (state.evaluations % 100 == 0)
+      calls++;
+  }
+};
+
+int test_observer_pipeline() {
+  using namespace sevobench;
+  using namespace sevobench::experiment;
+  auto suite = seeded_suite(2024);
+  best_so_far_record<float> logger(suite, bench_max_fes, 3, 10 * bench_dim);
+  stage_capture improved, fixed, last;
+  stage_counter counter;
+  auto pipeline = make_pipeline<float>(
+      when<trigger::always>(logger), when<trigger::every<100>>(counter),
+      when<trigger::on_improvement>(improved),
+      when<trigger::at_fes<10, 500, bench_max_fes>>(fixed),
+      when<trigger::final_only>(last));
+  evo_bench<true>(seeded_de(), suite, pipeline,
+                  bench_config{.independent_runs = 3,
+                               .seed = 2024,
+                               .checkpoint_dir = std::nullopt,
+                               .checkpoint_interval = 100});
+  auto best = [&](const auto &r) {
+    const auto &trace = logger.at(r.index, r.instance)[r.run_id - 1];
+    return trace.back().second;
+  };
+  bool same = std::ranges::equal(logger.best(), seeded_bench(2024)) &&
+              counter.calls == 12 * 2 * 3 * (bench_max_fes / 100) &&
+              improved.runs.size() == 72 && fixed.runs.size() == 72 &&
+              last.runs.size() == 72;
+  for (auto &r : improved.runs)
+    same = same && std::ranges::is_sorted(r.seen | std::views::values,
+                                          std::greater<>()) &&
+           r.seen.back().second == best(r);
+  for (auto &r : fixed.runs)
+    same = same && std::ranges::equal(r.seen | std::views::keys,
+                                      std::vector{10, 500, bench_max_fes});
+  for (auto &r : last.runs)
+    same = same && r.seen.size() == 1 &&
+           r.seen[0] == std::pair(bench_max_fes, best(r));
+  if (!same) {
+    std::cout << "observer pipeline is failed!\n";
+    return -1;
+  }
+  std::cout << "observer pipeline is true!\n";
+  return 0;
+}
+
+struct evaluation_counter final
+    : sevobench::experiment::suite_observer<float> {
+  int calls = 0;
+  void log(const sevobench::problem::problem_state<float> &,
+           const sevobench::problem::problem_info<float> &) override {
+    calls++;
+  }
+};
+
+// Cached evaluations return the stored value and are logged only when hits
+// count toward FES; with hits counted, runs report what uncached runs do.
+int test_eval_cache() {
+  using namespace sevobench;
+  using namespace sevobench::experiment;
+  eval_cache<double> c(5, 3);
+  const std::vector<double> a{1, 0, 2}, b{1, -0.0, 2};
+  c.insert(a, c.key(a), 7);
+  bool same = c.capacity() == 8 && c.find(a, c.key(a)) == 7.0 &&
+              !c.find(b, c.key(b)) && c.hits() == 1;
+  auto suite = seeded_suite(2024);
+  auto *p = suite.begin()->get();
+  // The cached scalar value of x answers both batch rows holding x.
+  std::vector<float> x(bench_dim, 1.5f), X(3 * bench_dim, 1.5f), out(3);
+  std::ranges::fill(X.begin() + bench_dim, X.begin() + 2 * bench_dim, 2.5f);
+  std::vector<float> expected(3);
+  p->evaluate_batch(X, 3, bench_dim, expected);
+  expected[0] = expected[2] = (*p)(x);
+  for (bool count_hits : {true, false}) {
+    evaluation_counter counter;
+    eval_cache<float> cache(16, bench_dim);
+    experiment::detail::suite_problem f(p, counter, 1);
+    f.use_cache(&cache, count_hits);
+    const auto f1 = f(x), f2 = f(x);
+    f.evaluate_batch(X, 3, bench_dim, out);
+    same = same && f1 == expected[0] && f2 == f1 && out == expected &&
+           cache.hits() == 3 && counter.calls == (count_hits ? 5 : 2);
+  }
+  auto uncached = seeded_bench(2024);
+  best_so_far_record<float> logger(suite, bench_max_fes, 3, 10 * bench_dim);
+  evo_bench<true>(seeded_de(), suite, logger,
+                  bench_config{.independent_runs = 3,
+                               .seed = 2024,
+                               .checkpoint_dir = std::nullopt,
+                               .checkpoint_interval = 100,
+                               .cache_size = 1024,
+                               .cache_counts_fes = true});
+  if (!same || !std::ranges::equal(logger.best(), uncached)) {
+    std::cout << "eval cache is failed!\n";
+    return -1;
+  }
+  std::cout << "eval cache is true!\n";
+  return 0;
+}
+
+struct evaluation_order final : sevobench::experiment::suite_observer<float> {
+  std::vector<int> seen;
+  void log(const sevobench::problem::problem_state<float> &s,
+           const sevobench::problem::problem_info<float> &) override {
+    seen.push_back(s.evaluations);
+  }
+};
+
+// A problem evaluated from several threads through concurrent_objective
+// logs every evaluation once, numbered without gaps.
+int test_concurrent_problem() {
+  using namespace sevobench;
+  auto suite = seeded_suite(2024);
+  auto *p = suite.begin()->get();
+  evaluation_order order;
+  experiment::detail::suite_problem f(p, order, 1);
+  std::mutex mut;
+  auto g = concurrent_objective(f, mut);
+  parallel_task pool(4);
+  population<float> pop(256, bench_dim, f.lower_bound(), f.upper_bound());
+  for (int r = 0; r < 20; r++) {
+    evaluate_population(pop, f, pop.pop_size(), pool);
+    std::vector<std::future<void>> v;
+    for (int i = 0; i < pop.pop_size(); i++)
+      v.emplace_back(pool.submit([&, i] { pop[i].evaluate(g); }));
+    for (auto &_ : v)
+      _.get();
+  }
+  std::ranges::sort(order.seen);
+  bool same = f.current_fes() == 20 * 2 * 256 &&
+              std::ssize(order.seen) == f.current_fes();
+  for (int i = 0; same && i < f.current_fes(); i++)
+    same = order.seen[i] == i + 1;
+  if (!same) {
+    std::cout << "concurrent problem is failed!\n";
+    return -1;
+  }
+  std::cout << "concurrent problem is true!\n";
+  return 0;
+}
+
+// DE with the jSO parameters on CEC2017 F20-F30, timed.
+int test_cec2017_bench() {
   constexpr int Dim = 30;
   constexpr int MaxFES = 10000 * Dim;
   constexpr int Runs = 10;
@@ -59,4 +533,16 @@ int main() {
     }
   std::cout << std::chrono::duration_cast<std::chrono::seconds>(t1 - t0).count()
             << "s\n";
-}
\ No newline at end of file
+  return 0;
+}
+
+int main() {
+  if (test_reproducible_bench() != 0 || test_resumed_bench() != 0 ||
+      test_copied_problem() != 0 || test_trace_stream() != 0 ||
+      test_trace_dims() != 0 || test_resumed_trace() != 0 ||
+      test_runtime_analysis() != 0 || test_observer_pipeline() != 0 ||
+      test_eval_cache() != 0 || test_concurrent_problem() != 0 ||
+      test_cec2017_bench() != 0)
+    return -1;
+  return 0;
+}
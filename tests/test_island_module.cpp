@@ -0,0 +1,163 @@
+#include "SEvoBench/sevobench.hpp"
+#include <atomic>
+#include <iostream>
+
+template <std::floating_point T> inline auto sphere(std::span<const T> x) {
+  T sum = 0;
+  for (auto _ : x)
+    sum += _ * _;
+  return sum;
+}
+
+int test_topology() {
+  using namespace sevobench::island_module;
+  auto ring = ring_topology().neighbors(4);
+  auto torus = torus_topology().neighbors(6);
+  auto random = random_topology().neighbors(5);
+  if (ring[3] != std::vector<int>{0})
+    return -1;
+  // 2 x 3 grid: up and down are the same island.
+  for (auto &_ : torus)
+    if (_.size() != 3)
+      return -1;
+  if (random[2].size() != 4 || random_topology().broadcast())
+    return -1;
+  std::cout << "island topology is true!\n";
+  return 0;
+}
+
+// Migrants come out of every edge in order, and a full edge drops them.
+template <typename Transport> bool check_fifo(Transport &send, Transport &recv) {
+  constexpr int Dim = 3;
+  std::vector<double> x(Dim), y(Dim);
+  double fit;
+  for (int k = 0; k < 2; k++) {
+    std::ranges::fill(x, k);
+    if (!send.send(0, 1, x, double(k)))
+      return false;
+  }
+  if (send.send(0, 1, x, 2.0) || send.send(0, 2, x, 2.0))
+    return false;
+  for (int k = 0; k < 2; k++)
+    if (!recv.receive(1, y, fit) || fit != k || y != std::vector<double>(Dim, k))
+      return false;
+  return !recv.receive(1, y, fit) && !recv.receive(0, y, fit);
+}
+
+int test_transport() {
+  using namespace sevobench::island_module;
+  auto neighbors = ring_topology().neighbors(3);
+  in_process_transport<double> local(neighbors, 3, 2);
+  if (!check_fifo(local, local))
+    return -1;
+#ifdef SEVOBENCH_HAS_SHM_TRANSPORT
+  auto name = "/sevobench_test_island_" + std::to_string(::getpid());
+  shm_transport<double> owner(name, neighbors, 3, 2, true);
+  shm_transport<double> other(name, neighbors, 3, 2, false);
+  if (!owner.valid() || !other.valid() || !check_fifo(owner, other))
+    return -1;
+  // A segment that does not exist carries nothing, and no model runs on it.
+  auto missing = std::make_unique<shm_transport<double>>(
+      name + "_missing", neighbors, 3, 2, false);
+  std::vector<double> x(3);
+  double fit;
+  if (missing->valid() || missing->send(0, 1, x, 1.0) ||
+      missing->receive(1, x, fit))
+    return -1;
+  island_model<double> model(island_config{.islands = 3},
+                             std::make_unique<ring_topology>(),
+                             std::move(missing));
+  bool ran = false;
+  if (model.valid() || model.run([&](int, auto) { ran = true; }) || ran)
+    return -1;
+#endif
+  std::cout << "island transport is true!\n";
+  return 0;
+}
+
+int test_island_de() {
+  using namespace sevobench;
+  using namespace sevobench::island_module;
+  using namespace sevobench::de_module;
+  constexpr int Dim = 10;
+  constexpr int Pop_Size = 20;
+  constexpr int Max_Fes = Dim * 2000;
+  island_config config{.islands = 4, .interval = 5, .migrants = 2,
+                       .capacity = 4};
+  island_model<double> model(config, Dim, std::make_unique<torus_topology>());
+  std::vector<double> best(config.islands);
+  std::atomic<int> received{0};
+  model.run([&](int id, auto migrate) {
+    evolutionary_algorithm alg(Max_Fes);
+    population<double> pop(Pop_Size, Dim, -100.0, 100.0);
+    static_de_algorithm_builder<double>()
+        .parameter(jade_parameter<double>())
+        .mutation(ttpb1_mutation<double>())
+        .constraint_handler(midpoint_target_repair<double>())
+        .crossover(binomial_crossover<double>())
+        .population_strategy(de_population<double>())
+        .build()
+        .run(pop, sphere<double>, -100.0, 100.0, alg, [&](auto &p, auto &a) {
+          return migrate(p, a);
+        });
+    received += migrate.received();
+    best[id] = std::ranges::min_element(pop, {}, [](const auto &x) {
+                 return x.fitness();
+               })->fitness();
+    if (alg.current_fes() < Max_Fes)
+      best[id] = 1e300;
+  });
+  if (received == 0)
+    return -1;
+  for (auto _ : best)
+    if (!(_ < 1e-3))
+      return -1;
+  std::cout << "island de is true!\n";
+  return 0;
+}
+
+// A PSO island moves a migrant copied into its swarm before evaluating it,
+// so the migrant must reach the topology's personal bests instead.
+int test_island_pso() {
+  using namespace sevobench;
+  using namespace sevobench::island_module;
+  using namespace sevobench::pso_module;
+  constexpr int Dim = 10;
+  constexpr int Pop_Size = 20;
+  island_config config{.islands = 2, .interval = 1, .migrants = 1,
+                       .capacity = 4};
+  island_model<double> model(config, Dim);
+  const std::vector<double> optimum(Dim, 0.0);
+  model.transport().send(1, 0, optimum, 0.0);
+  double best = -1;
+  int received = 0;
+  const bool ran = model.run(
+      [&](int, auto migrate) {
+        evolutionary_algorithm alg(Pop_Size * 10);
+        population<double> pop(Pop_Size, Dim, -100.0, 100.0);
+        pso_velocity<double> vec(Pop_Size, particle_velocity<double>(Dim));
+        auto pso =
+            pso_algorithm_builder<double>()
+                .update(std::make_unique<inertia_weight_update<double>>())
+                .topology(std::make_unique<gbest_topology<double>>())
+                .build();
+        pso.run(pop, vec, sphere<double>, -100.0, 100.0, alg,
+                [&](auto &p, auto &a) {
+                  return migrate(p, a, *pso.topology());
+                });
+        received = migrate.received();
+        best = pso.topology()->best_value();
+      },
+      0, 1);
+  if (!ran || received != 1 || best != 0)
+    return -1;
+  std::cout << "island pso is true!\n";
+  return 0;
+}
+
+int main() {
+  if (test_topology() != 0 || test_transport() != 0 || test_island_de() != 0 ||
+      test_island_pso() != 0)
+    return -1;
+  return 0;
+}
@@ -1,6 +1,6 @@
-
 #include "SEvoBench/sevobench.hpp"
 #include <cassert>
+#include <ctime>
 #include <iostream>
 #include <set>
 
@@ -20,4 +20,49 @@ template <int N> void test_parallel_task() {
   }
 }
 
-int main() { test_parallel_task<1>(); }
\ No newline at end of file
+int test_nested_submit() {
+  std::atomic<int> count{0};
+  {
+    sevobench::parallel_task pool(4);
+    std::vector<std::future<void>> f;
+    for (int i = 0; i < 64; i++)
+      f.emplace_back(pool.submit([&] {
+        (void)pool.submit([&] { ++count; });
+        ++count;
+      }));
+    for (auto &_ : f)
+      _.get();
+  }
+  if (count != 64 * 2) {
+    std::cout << "parallel_task is failed!\n";
+    return -1;
+  }
+  std::cout << "work stealing is true!\n";
+  return 0;
+}
+
+// Once a burst of tasks has drained, idle workers park instead of spinning.
+int test_idle_workers_park() {
+  sevobench::parallel_task pool(4);
+  std::atomic<int> count{0};
+  std::vector<std::future<void>> f;
+  for (int i = 0; i < 10000; i++)
+    f.emplace_back(pool.submit([&] { ++count; }));
+  for (auto &_ : f)
+    _.get();
+  const auto c0 = std::clock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  const double busy = double(std::clock() - c0) / CLOCKS_PER_SEC;
+  if (count != 10000 || busy > 0.1) {
+    std::cout << "parallel_task parking is failed!\n";
+    return -1;
+  }
+  std::cout << "parallel_task parking is true!\n";
+  return 0;
+}
+
+int main() {
+  test_parallel_task<1>();
+  test_parallel_task<1000>();
+  return test_nested_submit() != 0 || test_idle_workers_park() != 0 ? -1 : 0;
+}
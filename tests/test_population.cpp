@@ -0,0 +1,103 @@
+#include "SEvoBench/sevobench.hpp"
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+
+template <typename T> T sphere(std::span<const T> x) {
+  return std::inner_product(x.begin(), x.end(), x.begin(), T(0));
+}
+
+// Whether the rows of pop lie in order in one aligned buffer.
+template <typename T> bool contiguous(const sevobench::population<T> &pop) {
+  const auto stride = sevobench::tool::padded_size<T>(pop.dim());
+  if (reinterpret_cast<std::uintptr_t>(pop[0].data()) %
+          sevobench::tool::cache_line_size !=
+      0)
+    return false;
+  for (int i = 0; i < pop.pop_size(); i++)
+    if (pop[i].data() != pop[0].data() + i * stride)
+      return false;
+  return true;
+}
+
+template <typename T> int test_population() {
+  using namespace sevobench;
+  constexpr int Pop_Size = 50;
+  constexpr int Dim = 30;
+  population<T> pop(Pop_Size, Dim, T(-10), T(10));
+  auto copy = pop;
+  if (!contiguous(pop) || !contiguous(copy) || copy[0].data() == pop[0].data())
+    return -1;
+  std::vector<const T *> rows;
+  for (auto &_ : pop)
+    rows.push_back(_.data());
+  // Assignment and swaps between populations move values, not rows.
+  copy[1][0] = T(42);
+  std::ranges::swap(pop[0], copy[1]);
+  if (pop[0][0] != T(42) || pop[0].data() != rows[0] || !contiguous(copy))
+    return -1;
+  pop = copy;
+  if (pop[1] != copy[1] || !contiguous(pop) || pop[0].data() != rows[0])
+    return -1;
+  evolutionary_algorithm alg(Dim * 200);
+  de_module::de_algorithm_builder<T>()
+      .mutation(std::make_unique<de_module::ttpb1_mutation<T>>())
+      .parameter(std::make_unique<de_module::shade_parameter<T>>())
+      .constraint_handler(std::make_unique<de_module::projection_repair<T>>())
+      .crossover(std::make_unique<de_module::binomial_crossover<T>>())
+      .archive(std::make_unique<de_module::fifo_archive<T>>())
+      .population_strategy(std::make_unique<de_module::de_population<T>>())
+      .build()
+      .run(pop, sphere<T>, T(-10), T(10), alg);
+  // ttpb1 reorders pop, which permutes its rows within the buffer.
+  std::vector<const T *> after;
+  for (auto &_ : pop) {
+    after.push_back(_.data());
+    if (_.fitness() != sphere<T>(_))
+      return -1;
+  }
+  if (!std::ranges::is_permutation(after, rows))
+    return -1;
+  population<T> swarm(Pop_Size, Dim, T(-10), T(10));
+  rows.clear();
+  for (auto &_ : swarm)
+    rows.push_back(_.data());
+  pso_module::pso_velocity<T> vec(Pop_Size,
+                                  pso_module::particle_velocity<T>(Dim));
+  evolutionary_algorithm alg2(Dim * 200);
+  pso_module::static_pso_algorithm_builder<T>()
+      .update(pso_module::inertia_weight_update<T>())
+      .topology(pso_module::lbest_topology<T>())
+      .constraint_handler(
+          pso_module::static_pso_constraint<
+              T, pso_module::spso_velocity_constraint<T>>{.vc = {-4, 4},
+                                                          .pc = {}})
+      .build()
+      .run(swarm, vec, sphere<T>, T(-10), T(10), alg2);
+  for (int i = 0; i < Pop_Size; i++)
+    if (swarm[i].data() != rows[i])
+      return -1;
+  {
+    checkpoint ar;
+    ar(pop);
+    if (!ar.save("test_population.ckpt"))
+      return -1;
+  }
+  population<T> restored;
+  auto ar = checkpoint::load("test_population.ckpt");
+  ar(restored);
+  std::remove("test_population.ckpt");
+  if (!ar.good() || !contiguous(restored) ||
+      !std::ranges::equal(restored, pop) ||
+      restored[7].fitness() != pop[7].fitness())
+    return -1;
+  std::cout << "population<" << typeid(T).name() << "> is true!\n";
+  return 0;
+}
+
+int main() {
+  if (test_population<float>() != 0 || test_population<double>() != 0) {
+    std::cout << "test_population is failed!\n";
+    return -1;
+  }
+}
@@ -110,4 +110,107 @@ template <std::floating_point T> void test_pso() {
     }
 }
 
-int main() { test_pso<float>(); }
\ No newline at end of file
+template <std::floating_point T> int test_static_pso() {
+  using namespace sevobench::pso_module;
+  constexpr int Pop_Size = 40;
+  constexpr int Dim = 30;
+  sevobench::evolutionary_algorithm alg(2000 * Dim);
+  sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+  pso_velocity<T> vec(Pop_Size, particle_velocity<T>(Dim));
+  auto pso = static_pso_algorithm_builder<T>()
+                 .update(inertia_weight_update<T>())
+                 .topology(lbest_topology<T>())
+                 .constraint_handler(
+                     static_pso_constraint<T, spso_velocity_constraint<T>>{
+                         .vc = {-40, 40}, .pc = {}})
+                 .build();
+  auto init = std::numeric_limits<T>::max();
+  for (auto &x : pop)
+    init = std::min(init, x.evaluate(real_func<Dim, T>));
+  pso.run(pop, vec, real_func<Dim, T>, T(-100), T(100), alg);
+  if (!(pso.topology().best_value() < init))
+    return -1;
+  std::printf("static pso builder is true!\n");
+  return 0;
+}
+
+// Parallel swarm evaluation must not change a seeded run (fitness is
+// compared loosely, as -ffast-math may compile f differently per call site).
+template <std::floating_point T> int test_parallel_pso() {
+  using namespace sevobench::pso_module;
+  constexpr int Pop_Size = 37;
+  constexpr int Dim = 30;
+  sevobench::parallel_task pool(3);
+  auto go = [&](bool parallel) {
+    sevobench::tool::seed_scope scope(11, 1, 1, 1);
+    sevobench::evolutionary_algorithm alg(300 * Dim);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    pso_velocity<T> vec(Pop_Size, particle_velocity<T>(Dim));
+    auto pso = pso_algorithm_builder<T>()
+                   .update(std::make_unique<inertia_weight_update<T>>())
+                   .topology(std::make_unique<gbest_topology<T>>())
+                   .build();
+    if (parallel)
+      pso.run_parallel(pop, vec, real_func<Dim, T>, T(-100), T(100), alg,
+                       pool);
+    else
+      pso.run(pop, vec, real_func<Dim, T>, T(-100), T(100), alg);
+    return pop;
+  };
+  auto p1 = go(false);
+  auto p2 = go(true);
+  for (int i = 0; i < Pop_Size; i++)
+    if (p1[i] != p2[i] || std::abs(p1[i].fitness() - p2[i].fitness()) >
+                              T(1e-5) * std::abs(p1[i].fitness()))
+      return -1;
+  std::printf("parallel pso is true!\n");
+  return 0;
+}
+
+// Swarm, velocities, personal bests and generator states all come back from
+// a checkpoint, so a stopped and resumed run ends where a whole one does.
+template <std::floating_point T> int test_checkpoint_pso() {
+  using namespace sevobench::pso_module;
+  constexpr int Pop_Size = 30;
+  constexpr int Dim = 10;
+  const std::string path = "test_pso_module.ckpt";
+  int calls = 0;
+  auto f = [&](std::span<const T> x) {
+    calls++;
+    return real_func<Dim, T>(x);
+  };
+  auto go = [&](int stop) {
+    sevobench::tool::seed_scope seeds(5, 1, 1, 1);
+    sevobench::checkpoint_scope scope(path, 4);
+    sevobench::evolutionary_algorithm alg(500 * Dim);
+    sevobench::population<T> pop(Pop_Size, Dim, T(-100), T(100));
+    pso_velocity<T> vec(Pop_Size, particle_velocity<T>(Dim));
+    auto pso = pso_algorithm_builder<T>()
+                   .update(std::make_unique<inertia_weight_update<T>>())
+                   .topology(std::make_unique<random_topology<T>>(2))
+                   .build();
+    pso.run(pop, vec, f, T(-100), T(100), alg, [=](auto &, auto &a) {
+      return a.current_fes() < std::min(a.max_fes(), stop);
+    });
+    return std::tuple(pop, vec, pso.topology()->best_value());
+  };
+  std::remove(path.c_str());
+  auto full = go(std::numeric_limits<int>::max());
+  std::remove(path.c_str());
+  const int full_calls = std::exchange(calls, 0);
+  go(1000);
+  auto resumed = go(std::numeric_limits<int>::max());
+  std::remove(path.c_str());
+  if (full != resumed || calls != full_calls)
+    return -1;
+  std::printf("pso checkpoint is true!\n");
+  return 0;
+}
+
+int main() {
+  if (test_parallel_pso<float>() != 0 || test_checkpoint_pso<double>() != 0)
+    return -1;
+  if (test_static_pso<float>() != 0)
+    return -1;
+  test_pso<float>();
+}
\ No newline at end of file
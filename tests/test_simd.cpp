@@ -29,5 +29,156 @@ template <int Dim, std::floating_point T> void test() {
         x.data());
     std::cout << v1 << "," << v2 << '\n';
   }
+  {
+    auto v1 =
+        problem::simd::sphere<true, Dim, problem::simd_width<T>, T>(x.data());
+    auto v2 =
+        problem::simd::sphere<false, Dim, problem::simd_width<T>, T>(x.data());
+    std::cout << v1 << "," << v2 << '\n';
+  }
+  {
+    auto v1 = problem::simd::rosenbrock<true, Dim, problem::simd_width<T>, T>(
+        x.data());
+    auto v2 = problem::simd::rosenbrock<false, Dim, problem::simd_width<T>, T>(
+        x.data());
+    std::cout << v1 << "," << v2 << '\n';
+  }
+  {
+    auto v1 = problem::simd::schwefel_1<true, Dim, problem::simd_width<T>, T>(
+        x.data());
+    auto v2 = problem::simd::schwefel_1<false, Dim, problem::simd_width<T>, T>(
+        x.data());
+    std::cout << v1 << "," << v2 << '\n';
+  }
+}
+
+// long double never takes the SIMD path, so it serves as the reference.
+template <int Dim> bool test_cec_basic() {
+  using namespace sevobench::problem::cec_detail;
+  std::default_random_engine gen{Dim};
+  std::uniform_real_distribution<double> dis(-100, 100);
+  bool ok = true;
+  auto check = [&](const char *name, auto f, auto g) {
+    for (int r = 0; r < 20; r++) {
+      std::array<double, Dim> x;
+      std::array<long double, Dim> y;
+      for (int i = 0; i < Dim; i++)
+        y[i] = x[i] = dis(gen);
+      const auto x0 = x;
+      const auto y0 = y;
+      long double v1 = f(std::span<double, Dim>(x));
+      long double v2 = g(std::span<long double, Dim>(y));
+      if (x != x0 || y != y0) {
+        std::cout << name << " modified its input\n";
+        ok = false;
+        return;
+      }
+      if (std::abs(v1 - v2) > 1e-8L * std::max(1.0L, std::abs(v2))) {
+        std::cout << name << " failed: " << double(v1) << "," << double(v2)
+                  << '\n';
+        ok = false;
+        return;
+      }
+    }
+  };
+#define CHECK_FUNC(F) check(#F, F<double, Dim>, F<long double, Dim>)
+  CHECK_FUNC(zakharov_func);
+  CHECK_FUNC(rosenbrock_func);
+  CHECK_FUNC(escaffer6_func);
+  CHECK_FUNC(rastrigin_func);
+  CHECK_FUNC(levy_func);
+  CHECK_FUNC(bent_cigar_func);
+  CHECK_FUNC(hgbat_func);
+  CHECK_FUNC(katsuura_func);
+  CHECK_FUNC(ackley_func);
+  CHECK_FUNC(schwefel_func);
+  CHECK_FUNC(schwefel_F7_func);
+  CHECK_FUNC(happycat_func);
+  CHECK_FUNC(grie_rosen_func);
+  CHECK_FUNC(griewank_func);
+  CHECK_FUNC(ellips_func);
+  CHECK_FUNC(discus_func);
+  CHECK_FUNC(bi_rastrigin_func);
+  CHECK_FUNC(weierstrass_func);
+#undef CHECK_FUNC
+  return ok;
+}
+
+// block_rotation against the per-group rotate_func it replaces, for one
+// candidate and for a batch.
+template <int G, std::floating_point T> bool test_block_rotation() {
+  using namespace sevobench;
+  constexpr int Groups = 3;
+  constexpr int N = 11;
+  std::vector<T> m(Groups * G * G), o(Groups * G), X(N * Groups * G);
+  for (int g = 0; g < Groups; g++)
+    tool::generate_rotate_vector<G>(std::span<T>(m.data() + g * G * G, G * G));
+  std::default_random_engine gen{G};
+  std::uniform_real_distribution<T> dis(-100, 100);
+  std::generate(o.begin(), o.end(), [&] { return dis(gen); });
+  std::generate(X.begin(), X.end(), [&] { return dis(gen); });
+  problem::simd::block_rotation<G, T> br(m, Groups);
+  std::vector<T> Y(X.size()), Y1(Groups * G);
+  br.apply(X.data(), N, Groups * G, o.data(), Y.data(), Groups * G);
+  for (int b = 0; b < N; b++) {
+    std::vector<T> z(Groups * G);
+    for (int i = 0; i < Groups * G; i++)
+      z[i] = X[b * Groups * G + i] - o[i];
+    for (int g = 0; g < Groups; g++)
+      problem::simd::rotate_func<G, T>(z.data() + g * G, m.data() + g * G * G);
+    br.apply(X.data() + b * Groups * G, 1, 0, o.data(), Y1.data(), 0);
+    for (int i = 0; i < Groups * G; i++) {
+      if (std::abs(Y[b * Groups * G + i] - z[i]) > T(1e-3) ||
+          Y1[i] != Y[b * Groups * G + i]) {
+        std::cout << "block_rotation failed: " << Y[b * Groups * G + i] << ","
+                  << z[i] << '\n';
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// delta_evaluator after group-sized changes against full evaluation.
+template <int Index> bool test_delta() {
+  using namespace sevobench;
+  using P = problem::simd::cec2010_setting<50>::cec2010<Index, 1000, double>;
+  P p(1);
+  auto d = p.make_delta_evaluator();
+  std::default_random_engine gen{Index};
+  std::uniform_real_distribution<double> dis(-5, 5);
+  std::vector<double> x(1000);
+  std::generate(x.begin(), x.end(), [&] { return dis(gen); });
+  d.reset(x);
+  std::vector<int> changed(50);
+  for (int r = 0; r < 40; r++) {
+    const int g = r * 7 % 20;
+    for (int j = 0; j < 50; j++) {
+      changed[j] = g * 50 + j;
+      x[changed[j]] = dis(gen);
+    }
+    const auto v1 = d.evaluate(x, changed);
+    const auto v2 = p(x);
+    if (std::abs(v1 - v2) > 1e-9 * std::max(1.0, std::abs(v2))) {
+      std::cout << "delta_evaluator failed: F" << Index << " " << v1 << ","
+                << v2 << '\n';
+      return false;
+    }
+    d.accept();
+  }
+  return true;
 }
-int main() { test<39, float>(); }
\ No newline at end of file
+
+int main() {
+  test<39, float>();
+  if (!test_block_rotation<50, float>() || !test_block_rotation<7, double>())
+    return -1;
+  std::cout << "block rotation is true!\n";
+  if (!test_delta<1>() || !test_delta<4>() || !test_delta<9>() ||
+      !test_delta<14>() || !test_delta<18>() || !test_delta<20>())
+    return -1;
+  std::cout << "delta evaluator is true!\n";
+  if (!test_cec_basic<10>() || !test_cec_basic<13>() || !test_cec_basic<50>())
+    return -1;
+  std::cout << "cec simd functions is true!\n";
+}
\ No newline at end of file
@@ -55,6 +55,67 @@ void test_kunth_shffule() {
     }
 }
 
+int test_philox() {
+  using namespace sevobench::tool;
+  static_assert(random_generator_concept<philox_rng, float>);
+  static_assert(random_generator_concept<philox_rng, double>);
+  constexpr auto r = philox4x32({0, 0, 0, 0}, {0, 0});
+  static_assert(r[0] == 0x6627e8d5 && r[1] == 0xe169c58d &&
+                r[2] == 0xbc57ac4c && r[3] == 0x9b00dbd8);
+  philox_rng a(stream_key{42, 1, 1, 1, 0}), b(stream_key{42, 1, 1, 1, 0}),
+      c(stream_key{42, 1, 1, 2, 0});
+  int same = 0;
+  for (int i = 0; i < 100; i++) {
+    auto x = a();
+    same += x == c();
+    if (x != b())
+      same = 100;
+  }
+  if (same > 1) {
+    std::cout << "philox_rng is failed!\n";
+    return -1;
+  }
+  std::uint32_t x1, x2;
+  {
+    seed_scope scope(7, 1, 1, 1);
+    x1 = rng()();
+  }
+  {
+    seed_scope scope(7, 1, 1, 1);
+    x2 = rng()();
+  }
+  if (x1 != x2) {
+    std::cout << "seed_scope is failed!\n";
+    return -1;
+  }
+  std::cout << "philox_rng is true!\n";
+  return 0;
+}
+
+template <typename T> int test_bulk_rng() {
+  using namespace sevobench::tool;
+  rng r(12345), r2(12345);
+  std::vector<T> u(10007), n(10007), c(10007), u2(10007);
+  fill_uniform(r, std::span<T>(u), T(-1), T(3));
+  fill_uniform(r2, std::span<T>(u2), T(-1), T(3));
+  fill_normal(r, std::span<T>(n), T(2), T(0.5));
+  fill_cauchy(r, std::span<T>(c), T(1), T(0.1));
+  const bool same = u == u2;
+  auto su = mean_std(u.begin(), u.end());
+  auto sn = mean_std(n.begin(), n.end());
+  auto sc = mean_std(c.begin(), c.end());
+  if (!same || su[2] < T(-1) || su[6] >= T(3) ||
+      std::abs(su[0] - T(1)) > T(0.05) || std::abs(sn[0] - T(2)) > T(0.05) ||
+      std::abs(sn[1] - T(0.5)) > T(0.05) || std::abs(sc[4] - T(1)) > T(0.01) ||
+      !std::all_of(n.begin(), n.end(),
+                   [](T x) { return std::abs(x - T(2)) < T(5); })) {
+    std::cout << "bulk rng is failed!\n";
+    return -1;
+  }
+  std::cout << "bulk rng is true!\n";
+  return 0;
+}
+
 #define TEST_STATS(T)                                                          \
   test_mean_std<T>();                                                          \
   test_find_median<T>();
@@ -63,5 +124,8 @@ void test_kunth_shffule() {
 int main() {
   test_kunth_shffule();
   TEST_STAT()
+  if (test_philox() != 0 || test_bulk_rng<float>() != 0 ||
+      test_bulk_rng<double>() != 0)
+    return -1;
   return 0;
 }